@@ -29,8 +29,15 @@
 #include "AvlTree.h"
 #include <limits>
 #include <sstream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#define BENCHMARK_SIZE 1000000
 
 void printMenu();
+void benchmarkAvlTree();
 
 template <class T> 
 void choose(AvlTree<T>& myTree);
@@ -55,17 +62,20 @@ int main()
 //****************************************************************************
 void printMenu()
 {
-	cout << " ________________________________ " << endl;
-	cout << "| +Key  | Insert Item            |" << endl;
-	cout << "| -Key  | Remove Item            |" << endl;
-	cout << "| ?Key  | Search Item            |" << endl;
-	cout << "| R     | Prune Tree             |" << endl;
-	cout << "| I     | Print Items In Order   |" << endl;
-	cout << "| P     | Print Items Pre Order  |" << endl;
-	cout << "| T     | Print Items Post Order |" << endl;
-	cout << "| @     | Print Cursor Value     |" << endl;
-	cout << "| D     | Delete the Tree        |" << endl;
-	cout << "|_______|________________________|" << endl << endl;
+	cout << " ________________________________________ " << endl;
+	cout << "| +Key  | Insert Item                    |" << endl;
+	cout << "| -Key  | Remove Item                    |" << endl;
+	cout << "| ?Key  | Search Item                    |" << endl;
+	cout << "| R     | Prune Tree                     |" << endl;
+	cout << "| I     | Print Items In Order           |" << endl;
+	cout << "| P     | Print Items Pre Order          |" << endl;
+	cout << "| T     | Print Items Post Order         |" << endl;
+	cout << "| H     | Print Items Hierarchical Order |" << endl;
+	cout << "| #K    | Find K-th Smallest             |" << endl;
+	cout << "| @     | Print Cursor Value             |" << endl;
+	cout << "| D     | Delete the Tree                |" << endl;
+	cout << "| B     | Run Benchmarks                 |" << endl;
+	cout << "|_______|________________________________|" << endl << endl;
     cout << "Please choose an operation to perform on the tree." << endl;
     cout << "Enter Q to quit." << endl;	
 }
@@ -199,12 +209,54 @@ void choose(AvlTree<T>& myTree)
 				}
 				break;
 			}
+			case 'h': case 'H':
+			{
+				if (hasInserted)
+				{
+					cout << "The contents of the tree printed in a hierarchical order are: \n";
+					myTree.PrintHierarchical();
+					cout << endl << endl;
+					system("pause");
+				}
+				else
+				{
+					cerr << "\nPlease insert data into the tree." << endl;
+					system("pause");					
+				}
+				break;
+			}
 			case 'd': case 'D':
 			{
 				myTree.~AvlTree();
 				hasInserted = false;
 				break;
 			}
+			case '#':
+			{
+				if (hasInserted)
+				{
+					int k = 0;
+					validateInput(k);
+					
+					if (myTree.Select(k - 1, key))
+						cout << endl << "Item " << k << " in order is " << key << "." << endl;
+					else
+						cerr << endl << "The tree does not have " << k << " items." << endl;
+					system("pause");
+				}
+				else
+				{
+					cerr << "\nPlease insert data into the tree." << endl;
+					system("pause");					
+				}
+				break;
+			}
+			case 'b': case 'B':
+			{
+				benchmarkAvlTree();
+				system("pause");
+				break;
+			}
 			case'@':
 			{
 				if (hasInserted)
@@ -246,6 +298,64 @@ void choose(AvlTree<T>& myTree)
 }
 /* End of choose function */
 
+//****************************************************************************
+//		This function will time inserting and searching for shuffled keys,
+//	then inserting sorted keys, and report the height of each tree.  The
+//	workload matches the scapegoat benchmark in the Binary Search Tree 
+//	driver so the results can be compared.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkAvlTree()
+{
+	using namespace std::chrono;
+	
+	vector<int> keys(BENCHMARK_SIZE);
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		keys[i] = i;
+	}
+	
+	mt19937 generator(42);
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	AvlTree<int> tree;
+	steady_clock::time_point start = steady_clock::now();
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		tree.Insert(keys[i]);
+	}
+	steady_clock::time_point stop = steady_clock::now();
+	long long insertTime = duration_cast<milliseconds>(stop - start).count();
+	
+	int found = 0;
+	start = steady_clock::now();
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		found += tree.Search(i);
+	}
+	stop = steady_clock::now();
+	long long searchTime = duration_cast<milliseconds>(stop - start).count();
+	
+	AvlTree<int> sortedTree;
+	start = steady_clock::now();
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		sortedTree.Insert(i);
+	}
+	stop = steady_clock::now();
+	
+	cout << endl << "     AVL Tree (" << BENCHMARK_SIZE << " keys): " << endl;
+	cout << "                Shuffled insert time = " << insertTime << " ms." << endl;
+	cout << "                Search time = " << searchTime << " ms." << endl;
+	cout << "                Found = " << found << endl;
+	cout << "                Height = " << tree.Height() << endl;
+	cout << "                Sorted insert time = " 
+		 << duration_cast<milliseconds>(stop - start).count() << " ms." << endl;
+	cout << "                Sorted height = " << sortedTree.Height() << endl << endl;
+}
+/* End of benchmarkAvlTree function */
+
 //****************************************************************************
 //		This function will validate the input from the user.  If the user
 //	enters an invalid option for the value, then a message will be displayed
@@ -9,10 +9,11 @@
 //****************************************************************************
 //		Method to insert key into the AVL Tree.  If the key is
 //	already in the tree, a message will be displayed informing the user.
-//	Otherwise, the method will try to allocate memory for a new node.  If
-//	it is successful the insertion will proceed.  Otherwise the exception
-//	will be caught and an appropriate message displayed.  The tree will also
-//	be balanced after insertion.
+//	Otherwise, the method will walk down to the empty link where the key
+//	belongs, recording each link it passes, and try to allocate memory for a
+//	new node there.  If it is successful the sizes on the path are counted
+//	up and the links are rebalanced from the bottom up.  Otherwise the 
+//	exception will be caught and an appropriate message displayed.
 //
 //	Parameters:
 //		key: the key to be inserted.
@@ -21,37 +22,79 @@
 template <class T>
 void AvlTree<T>::InsertHelper(const T key, AvlNode<T>*& subtree)
 {
-	if (subtree == NULL)
+	AvlNode<T>** path[AVL_MAX_HEIGHT];
+	AvlNode<T>** link  = &subtree;
+	int          depth = 0;
+	
+	while (*link != NULL)
 	{
-		try
+		path[depth++] = link;
+		
+		if (key < (*link)->data)
 		{
-			subtree = new AvlNode<T>(key);
-			cursor = subtree;
+			link = &(*link)->left;
 		}
-		catch (bad_alloc & ex)
+		else if (key > (*link)->data)
 		{
-			cerr << "Failed to insert " << key << " into the tree due to";
-    		cerr << " bad memory allocation exception." << endl;
+			link = &(*link)->right;
 		}
-		catch (...)
+		else
 		{
-			cerr << "Unregisterd exception." << endl;
+			cerr << "No duplicates allowed, please try again." << endl;
+			return;
 		}
 	}
-	else if (key < subtree->data)
+	
+	try
 	{
-		InsertHelper(key, subtree->left);
+		*link = new AvlNode<T>(key);
+		cursor = *link;
 	}
-	else if (key > subtree->data)
+	catch (bad_alloc & ex)
 	{
-		InsertHelper(key, subtree->right);
+		cerr << "Failed to insert " << key << " into the tree due to";
+		cerr << " bad memory allocation exception." << endl;
+		return;
 	}
-	else
+	catch (...)
+	{
+		cerr << "Unregisterd exception." << endl;
+		return;
+	}
+	
+#if AVL_ORDER_STATISTICS
+	for (int i = 0; i < depth; i++)
+	{
+		(*path[i])->size++;
+	}
+#endif
+	Rebalance(path, depth);
+}
+
+//****************************************************************************
+//		Method to balance each link on a recorded path, from the deepest 
+//	link back up to the root.  Once a subtree has kept the height it had 
+//	before the change, none of the subtrees above it can have changed, so
+//	the walk stops there.
+//
+//	Parameters:
+//		path: links from the root down to the changed subtree.
+//		depth: number of links in the path.
+//****************************************************************************
+template <class T>
+void AvlTree<T>::Rebalance(AvlNode<T>** path[], int depth)
+{
+	for (int i = depth - 1; i >= 0; i--)
 	{
-		cerr << "No duplicates allowed, please try again." << endl;
+		int oldHeight = (*path[i])->height;
+		
+		BalanceTree(*path[i]);
+		
+		if ((*path[i])->height == oldHeight)
+		{
+			break;
+		}
 	}
-     
-	BalanceTree(subtree);   
 }
 
 //****************************************************************************
@@ -119,6 +162,8 @@ void AvlTree<T>::RotateLeft(AvlNode<T>*& subtree)
 	
 	subtree->height = max(GetHeight(subtree->left), GetHeight(subtree->right)) + 1;
 	temp->height = max(GetHeight(temp->left), subtree->height) + 1;
+	UpdateSize(subtree);
+	UpdateSize(temp);
 	subtree = temp;
 }
 
@@ -150,6 +195,8 @@ void AvlTree<T>::RotateRight(AvlNode<T>*& subtree)
 	
 	subtree->height = max(GetHeight(subtree->right), GetHeight(subtree->left)) + 1;
 	temp->height = max(GetHeight(temp->right), subtree->height) + 1;
+	UpdateSize(subtree);
+	UpdateSize(temp);
 	subtree = temp;	
 }
 
@@ -212,14 +259,18 @@ bool AvlTree<T>::Search(const T key)
 				temp = temp->right;
 			}
 		}
-	}	
+	}
+	return false;
 }
 
 //****************************************************************************
-//		Method to delete a given key from the AVL Tree.  If this
-//	method is called on an empty tree, it will return.  If the key cannot be
-//	found within the tree, a message will be displayed to the user.  
-//	Otherwise, the method will proceed with deletion in the helper function.
+//		Method to delete a given key from the AVL Tree in a single walk
+//	down the tree.  Each link passed is recorded, so the tree can be 
+//	rebalanced from the bottom up without recursion.  If the node has both
+//	children, the walk continues to the smallest key of the right subtree,
+//	which is moved into the node and its own node unlinked.  If the key 
+//	cannot be found within the tree, a message will be displayed to the 
+//	user.
 //
 //	Parameters:
 //		key: the key to be deleted.
@@ -232,17 +283,59 @@ void AvlTree<T>::Delete(const T key)
 		return;
 	}
 	
-	bool isFound = Search(key);
+	AvlNode<T>** path[AVL_MAX_HEIGHT];
+	AvlNode<T>** link  = &root;
+	int          depth = 0;
 	
-	if (isFound == false)
+	while (*link != NULL && key != (*link)->data)
+	{
+		path[depth++] = link;
+		
+		if (key < (*link)->data)
+		{
+			link = &(*link)->left;
+		}
+		else
+		{
+			link = &(*link)->right;
+		}
+	}
+	
+	if (*link == NULL)
 	{
 		cerr << "There is not a node with value: " << key << endl;
+		return;
 	}
-	else 
+	
+	AvlNode<T>* node = *link;
+	
+	if (node->left != NULL && node->right != NULL)
 	{
-		DeleteHelper(key, root);
+		path[depth++] = link;
+		link = &node->right;
+		
+		while ((*link)->left != NULL)
+		{
+			path[depth++] = link;
+			link = &(*link)->left;
+		}
+		
+		node->data = (*link)->data;
+		node = *link;
 	}
 	
+	*link = (node->left != NULL) ? node->left : node->right;
+	cursor = *link;
+	delete node;
+	
+#if AVL_ORDER_STATISTICS
+	for (int i = 0; i < depth; i++)
+	{
+		(*path[i])->size--;
+	}
+#endif
+	Rebalance(path, depth);
+	
 	if (root == NULL)
 	{
 		cursor = NULL;	
@@ -250,217 +343,377 @@ void AvlTree<T>::Delete(const T key)
 }
 
 //****************************************************************************
-//		Helper method to delete a node with a given key.  After the 
-//	deletion the tree will be rebalanced.  
+//		Method to return the minimum value in the tree.
 //
 //	Parameters:
-//		key: the key to be deleted.
-//		subtree: pointer to the root of subtree.
+//		node: a root of a subtree
 //****************************************************************************
 template <class T>
-void AvlTree<T>::DeleteHelper(const T key, AvlNode<T>*& subtree)
+AvlNode<T>* AvlTree<T>::GetMin(AvlNode<T>* subtree) const
 {
-	if (subtree == NULL)
+	while(subtree->left != NULL) 
 	{
-		return;
+		subtree = subtree->left;
 	}
-	if (key < subtree->data)
+	return subtree;
+}
+
+//****************************************************************************
+//		Method to return the number of keys in the tree.  This is read from
+//	the root when subtree sizes are kept, and counted otherwise.
+//
+//	Parameters: N/A.
+//****************************************************************************
+template <class T>
+int AvlTree<T>::Size() const
+{
+#if AVL_ORDER_STATISTICS
+	return SizeOf(root);
+#else
+	vector<const AvlNode<T>*> pending;
+	int count = 0;
+	
+	if (root != NULL)
 	{
-		DeleteHelper(key, subtree->left);
+		pending.push_back(root);
 	}
-	else if (key > subtree->data)
+	while (!pending.empty())
 	{
-		DeleteHelper(key, subtree->right);
+		const AvlNode<T>* node = pending.back();
+		pending.pop_back();
+		count++;
+		
+		if (node->left != NULL)
+		{
+			pending.push_back(node->left);
+		}
+		if (node->right != NULL)
+		{
+			pending.push_back(node->right);
+		}
 	}
-	else if (subtree->left != NULL && subtree->right != NULL)
+	return count;
+#endif
+}
+
+//****************************************************************************
+//		Method to find the key with k smaller keys in the tree, counting from
+//	zero.  When subtree sizes are kept, each step compares k with the size 
+//	of the left subtree, so the walk is one path of O(log n) nodes.  
+//	Otherwise the keys are walked in order.  If k is out of range, the 
+//	method will return false.
+//
+//	Parameters:
+//		k: the position of the key in order.
+//		result: receives the key that was found.
+//****************************************************************************
+template <class T>
+bool AvlTree<T>::Select(int k, T& result) const
+{
+	if (k < 0)
 	{
-		subtree->data = GetMin(subtree->right)->data;
-		DeleteHelper(subtree->data, subtree->right);
+		return false;
 	}
-	else
+	
+	const AvlNode<T>* node = root;
+	
+#if AVL_ORDER_STATISTICS
+	while (node != NULL)
 	{
-		AvlNode<T>* oldNode = subtree;
+		int leftSize = SizeOf(node->left);
 		
-		if (subtree->left != NULL)
+		if (k < leftSize)
 		{
-			subtree = subtree->left;
-			cursor = subtree;
-		} 
+			node = node->left;
+		}
+		else if (k == leftSize)
+		{
+			result = node->data;
+			return true;
+		}
 		else
 		{
-			subtree = subtree->right;
-			cursor = subtree;	
+			k = k - leftSize - 1;
+			node = node->right;
 		}
+	}
+#else
+	vector<const AvlNode<T>*> pending;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		node = pending.back();
+		pending.pop_back();
 		
-		delete oldNode;
+		if (k == 0)
+		{
+			result = node->data;
+			return true;
+		}
+		k--;
+		node = node->right;
 	}
-	BalanceTree(subtree);
+#endif
+	return false;
 }
 
 //****************************************************************************
-//		Method to return the minimum value in the tree.
+//		Method to return the number of keys from low to high, inclusive.
 //
 //	Parameters:
-//		node: a root of a subtree
+//		low: the smallest key to count.
+//		high: the largest key to count.
 //****************************************************************************
 template <class T>
-AvlNode<T>* AvlTree<T>::GetMin(AvlNode<T>* subtree) const
+int AvlTree<T>::CountInRange(const T low, const T high) const
 {
-	while(subtree->left != NULL) 
+	if (high < low)
 	{
-		subtree = subtree->left;
+		return 0;
 	}
-	return subtree;
+	return CountBelow(high, true) - CountBelow(low, false);
 }
 
 //****************************************************************************
-//		Helper method to traverse the tree and check each node to see if it
-//	is a leaf.  If it is, the deletion method will be called on that node.
-//	Otherwise, the traversal will continue until the entire tree has been
-//	pruned of leaves.  
+//		Method to export the keys into a read only frozen tree, replacing 
+//	anything it held.  The keys are collected by ForEachInOrder, so they 
+//	are already sorted.  If a bad allocation error is detected, a message 
+//	will be displayed and false returned.
 //
 //	Parameters:
-//		subtree: pointer to the root of subtree.
+//		frozen: the frozen tree to fill.
 //****************************************************************************
+template <class T>
+bool AvlTree<T>::Freeze(FrozenTree<T>& frozen) const
+{
+	vector<T> keys;
+	
+	try
+	{
+		keys.reserve(Size());
+		ForEachInOrder([&](const T& key)
+		{
+			keys.push_back(key);
+			return true;
+		});
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to freeze the AVL Tree." << endl;
+		frozen.Clear();
+		return false;
+	}
+	
+	return frozen.Build(keys.empty() ? NULL : &keys[0], (int)keys.size());
+}
 
+//****************************************************************************
+//		Helper method to count the keys less than the given key, or not 
+//	greater than it when inclusive is set.  When subtree sizes are kept,
+//	every step right adds the left subtree and the node to the count.  
+//	Otherwise the keys are walked in order up to the first one past the 
+//	key.
+//
+//	Parameters:
+//		key: the key to count below.
+//		inclusive: whether a key equal to it is counted.
+//****************************************************************************
 template <class T>
-void AvlTree<T>::PruneHelper(AvlNode<T>* subtree)
+int AvlTree<T>::CountBelow(const T key, bool inclusive) const
 {
-    if (subtree != NULL)
-    {
-        PruneHelper(subtree->left);
-        if (isLeaf(subtree) && subtree != root)
-        {
-        	Delete(subtree->data);
+	const AvlNode<T>* node = root;
+	int count = 0;
+	
+#if AVL_ORDER_STATISTICS
+	while (node != NULL)
+	{
+		if (node->data < key || (inclusive && node->data == key))
+		{
+			count = count + SizeOf(node->left) + 1;
+			node = node->right;
+		}
+		else
+		{
+			node = node->left;
+		}
+	}
+#else
+	vector<const AvlNode<T>*> pending;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		node = pending.back();
+		pending.pop_back();
+		
+		if (!(node->data < key || (inclusive && node->data == key)))
+		{
+			break;
 		}
-        PruneHelper(subtree->right);
-    }	
+		count++;
+		node = node->right;
+	}
+#endif
+	return count;
 }
 
 //****************************************************************************
-//		Method to print the tree in level order.
+//		Method to return the number of nodes in a subtree, or zero if sizes
+//	are not kept.
 //
 //	Parameters:
-//		N/A.
+//		subtree: pointer to the root of subtree.
 //****************************************************************************
 template <class T>
-void AvlTree<T>::PrintTree() const
+int AvlTree<T>::SizeOf(const AvlNode<T>* subtree) const
 {
-	if (!root)
-	{
-        return;
-    }
+#if AVL_ORDER_STATISTICS
+	return (subtree == NULL) ? 0 : subtree->size;
+#else
+	(void)subtree;
+	return 0;
+#endif
+}
 
-    else
-    {
-        int ctr = 0;
-        while (ctr <= GetHeight(root))
-        {
-            PrintLevel(ctr);
-            ctr++;
-            cout << endl << endl;
-        }
-    }
+//****************************************************************************
+//		Method to recompute the size of a node from its children, after a 
+//	rotation has changed them.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+void AvlTree<T>::UpdateSize(AvlNode<T>* subtree)
+{
+#if AVL_ORDER_STATISTICS
+	subtree->size = SizeOf(subtree->left) + SizeOf(subtree->right) + 1;
+#else
+	(void)subtree;
+#endif
 }
 
 //****************************************************************************
-//		Recursively calculates the height of the tree.
+//		Helper method to remove every leaf from the tree, except the root.
+//	The leaves are gathered first with an explicit stack, since deleting 
+//	from an AVL Tree can rotate the nodes a traversal is still standing on,
+//	and each one is then deleted so the tree stays balanced.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
 //****************************************************************************
+
 template <class T>
-int AvlTree<T>::GetHeight(AvlNode<T>* subtree) const
+void AvlTree<T>::PruneHelper(AvlNode<T>* subtree)
 {
-	if (subtree == NULL)
+	vector<AvlNode<T>*> pending;
+	vector<T>           leaves;
+	
+	if (subtree != NULL)
 	{
-		return 0;
+		pending.push_back(subtree);
 	}
-	else
+	
+	while (!pending.empty())
 	{
-		int leftHeight = GetHeight(subtree->left);
-		int rightHeight = GetHeight(subtree->right);
+		AvlNode<T>* node = pending.back();
+		pending.pop_back();
 		
-		if (leftHeight >= rightHeight)
+		if (isLeaf(node))
 		{
-			return leftHeight + 1;
+			if (node != root)
+			{
+				leaves.push_back(node->data);
+			}
+			continue;
 		}
-		else
+		if (node->right != NULL)
 		{
-			return rightHeight + 1;
+			pending.push_back(node->right);
+		}
+		if (node->left != NULL)
+		{
+			pending.push_back(node->left);
 		}
 	}
+	
+	for (size_t i = 0; i < leaves.size(); i++)
+	{
+		Delete(leaves[i]);
+	}
 }
 
 //****************************************************************************
-//		Calculates width to space out nodes and calls DispLevel to print
-//	nodes on given level.
+//		Method to print the tree in level order.  The tree is walked once,
+//	so this is O(n) in the nodes shown, and the text is written to the 
+//	stream in large blocks.  By default the whole tree is printed.  If 
+//	maxDepth or maxWidth is positive, levels past maxDepth are left out and
+//	lines are kept within maxWidth characters.
 //
 //	Parameters:
-//		height: height of tree.
+//		out: the stream to print to, such as cout or an ofstream.
+//		maxDepth: the most levels to print, or 0 for no limit.
+//		maxWidth: the most characters on a line, or 0 for no limit.
 //****************************************************************************
+template <class T>
+void AvlTree<T>::PrintTree(ostream& out, int maxDepth, int maxWidth) const
+{
+	TreePrinter printer(out, maxDepth, maxWidth);
+	printer.PrintLevels(root, [this](const AvlNode<T>* subtree)
+	{
+		return NodeLabel(subtree);
+	});
+}
 
+//****************************************************************************
+//		Method for printing contents of the tree to resemble a file tree,
+//	with the same limits as PrintTree.
+//
+//	Parameters:
+//		out: the stream to print to, such as cout or an ofstream.
+//		maxDepth: the most levels to print, or 0 for no limit.
+//		maxWidth: the most characters on a line, or 0 for no limit.
+//****************************************************************************
 template <class T>
-void AvlTree<T>::PrintLevel(int height) const
+void AvlTree<T>::PrintHierarchical(ostream& out, int maxDepth, int maxWidth) const
 {
-	AvlNode<T>* temp = root;
-	
-	// leftmost point
-	int value = pow(2, GetHeight(root) - height + 2);
-	cout << setw(value) << "";
-	DispLevel(temp, height, value);
+	TreePrinter printer(out, maxDepth, maxWidth);
+	printer.PrintHierarchical(root, [this](const AvlNode<T>* subtree)
+	{
+		return NodeLabel(subtree);
+	});
 }
 
 //****************************************************************************
-//		Displays the nodes on given level and will display 'x' where the
-//	pointers are NULL.
+//		Helper method to return the text shown for a node by the printers.
+//	The node the cursor references is shown in brackets.
 //
 //	Parameters:
 //		subtree: node to be displayed.
-//		level: current level.
-//		displace: displacement.
 //****************************************************************************
 template <class T>
-void AvlTree<T>::DispLevel(AvlNode<T>* subtree, int level, int displace) const
+string AvlTree<T>::NodeLabel(const AvlNode<T>* subtree) const
 {
-	int disp = 2 * displace;
-	if (level == 0)
+	ostringstream text;
+	if (subtree == cursor)
 	{
-		if (subtree == NULL)
-		{
-			cout << " x ";
-			cout << setw(disp - 3) << "";
-			return;
-		}
-		else
-		{
-			int result = ((subtree->data <= 1) ? 1: log10(subtree->data) + 1);
-			if (subtree == cursor)
-			{
-				cout << "[" << subtree->data << "]";
-			}
-			else
-			{
-				cout << subtree->data;
-			}
-
-			cout << setw(disp - result) << "";
-		}
+		text << "[" << subtree->data << "]";
 	}
-	
 	else
 	{
-		if (subtree == NULL && level >= 1)
-		{
-			DispLevel(NULL, level - 1, displace);
-			DispLevel(NULL, level - 1, displace);
-		}
-		else
-		{
-			DispLevel(subtree->left, level - 1, displace);
-			DispLevel(subtree->right, level - 1, displace);
-		}
+		text << subtree->data;
 	}
+	return text.str();
 }
 
 //****************************************************************************
@@ -498,7 +751,9 @@ void AvlTree<T>::InOrder() const
 }
 
 //****************************************************************************
-//		Helper method to print the contents of the tree in order.
+//		Helper method to print the contents of the tree in order.  The left
+//	spine of each subtree is pushed onto an explicit stack in place of
+//	recursion.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
@@ -507,21 +762,30 @@ void AvlTree<T>::InOrder() const
 template <class T>
 void AvlTree<T>::InOrderHelper(const AvlNode<T>* subtree) const
 {
-    if (subtree != NULL)
-    {
-        InOrderHelper(subtree->left);
-        
-        if (subtree == cursor)
-        {
-        	cout << "[" << subtree->data << "] ";
-        }
-        else
-        {
+	vector<const AvlNode<T>*> pending;
+	
+	while (subtree != NULL || !pending.empty())
+	{
+		while (subtree != NULL)
+		{
+			pending.push_back(subtree);
+			subtree = subtree->left;
+		}
+		
+		subtree = pending.back();
+		pending.pop_back();
+		
+		if (subtree == cursor)
+		{
+			cout << "[" << subtree->data << "] ";
+		}
+		else
+		{
 			cout << subtree->data << " ";
 		}
-			
-        InOrderHelper(subtree->right);
-    }
+		
+		subtree = subtree->right;
+	}
 }
 
 //****************************************************************************
@@ -539,7 +803,8 @@ void AvlTree<T>::PreOrder() const
 }
 
 //****************************************************************************
-//		Helper method to print the contents of the tree in pre order.
+//		Helper method to print the contents of the tree in pre order, using
+//	an explicit stack in place of recursion.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
@@ -547,20 +812,37 @@ void AvlTree<T>::PreOrder() const
 template <class T>
 void AvlTree<T>::PreOrderHelper(const AvlNode<T>* subtree) const
 {
-    if (subtree != NULL)
-    {
-    	if (subtree == cursor)
-    	{
-        	cout << "[" << subtree->data << "] ";
-        }
-        else
-        {
+	if (subtree == NULL)
+	{
+		return;
+	}
+	
+	vector<const AvlNode<T>*> pending;
+	pending.push_back(subtree);
+	
+	while (!pending.empty())
+	{
+		subtree = pending.back();
+		pending.pop_back();
+		
+		if (subtree == cursor)
+		{
+			cout << "[" << subtree->data << "] ";
+		}
+		else
+		{
 			cout << subtree->data << " ";
 		}
-			
-        PreOrderHelper(subtree->left);
-        PreOrderHelper(subtree->right);
-    }
+		
+		if (subtree->right != NULL)
+		{
+			pending.push_back(subtree->right);
+		}
+		if (subtree->left != NULL)
+		{
+			pending.push_back(subtree->left);
+		}
+	}
 }
 
 //****************************************************************************
@@ -578,7 +860,9 @@ void AvlTree<T>::PostOrder() const
 }
 
 //****************************************************************************
-//		Helper method to print the contents of the tree in post order.
+//		Helper method to print the contents of the tree in post order, using
+//	an explicit stack in place of recursion.  A node is printed once the
+//	last node printed is its right child, or it has no right child.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
@@ -586,20 +870,37 @@ void AvlTree<T>::PostOrder() const
 template <class T>
 void AvlTree<T>::PostOrderHelper(const AvlNode<T>* subtree) const
 {
-    if (subtree != NULL)
-    {
-        PostOrderHelper(subtree->left);
-        PostOrderHelper(subtree->right);
-        
-        if (subtree == cursor)
-        {
-        	cout << "[" << subtree->data << "] ";
-        }
-        else
-        {
-			cout << subtree->data << " ";
+	vector<const AvlNode<T>*> pending;
+	const AvlNode<T>* lastPrinted = NULL;
+	
+	while (subtree != NULL || !pending.empty())
+	{
+		while (subtree != NULL)
+		{
+			pending.push_back(subtree);
+			subtree = subtree->left;
 		}
-    }
+		
+		const AvlNode<T>* top = pending.back();
+		
+		if (top->right != NULL && top->right != lastPrinted)
+		{
+			subtree = top->right;
+			continue;
+		}
+		
+		if (top == cursor)
+		{
+			cout << "[" << top->data << "] ";
+		}
+		else
+		{
+			cout << top->data << " ";
+		}
+		
+		lastPrinted = top;
+		pending.pop_back();
+	}
 }
 
 //****************************************************************************
@@ -607,7 +908,7 @@ void AvlTree<T>::PostOrderHelper(const AvlNode<T>* subtree) const
 //****************************************************************************
 
 template <class T>
-AvlTree<T>::AvlTree(const AvlTree& myAvl)
+AvlTree<T>::AvlTree(const AvlTree& myAvl): cursor(NULL)
 {
     if(!myAvl.root)
     {
@@ -618,21 +919,42 @@ AvlTree<T>::AvlTree(const AvlTree& myAvl)
 }
 
 //****************************************************************************
-//		Helper method to recursively allocate memory for the new tree.
+//		Helper method to allocate memory for the new tree.  Pairs of source
+//	nodes and the links they are copied into are kept on an explicit stack,
+//	and each copy keeps the height and size of its source node.
 //****************************************************************************
 template<class T>
 void AvlTree<T>::CopyHelper(AvlNode<T>*& aRoot, AvlNode<T>* myRoot)
 {
-    if(!myRoot)
+    aRoot = NULL;
+    
+    vector<pair<AvlNode<T>*, AvlNode<T>**> > pending;
+    if (myRoot != NULL)
     {
-        aRoot = NULL;
-    }
-    else
+    	pending.push_back(make_pair(myRoot, &aRoot));
+	}
+    
+    while (!pending.empty())
     {
-        aRoot = new AvlNode<T>(myRoot->data);
-        CopyHelper(aRoot->left, myRoot->left);
-        CopyHelper(aRoot->right, myRoot->right);
-    }
+    	AvlNode<T>*  source = pending.back().first;
+    	AvlNode<T>** link   = pending.back().second;
+    	pending.pop_back();
+    	
+    	*link = new AvlNode<T>(source->data);
+    	(*link)->height = source->height;
+#if AVL_ORDER_STATISTICS
+    	(*link)->size = source->size;
+#endif
+    	
+    	if (source->right != NULL)
+    	{
+    		pending.push_back(make_pair(source->right, &(*link)->right));
+		}
+    	if (source->left != NULL)
+    	{
+    		pending.push_back(make_pair(source->left, &(*link)->left));
+		}
+	}
 }
 
 //****************************************************************************
@@ -647,18 +969,30 @@ AvlTree<T>::~AvlTree()
 }
 
 //****************************************************************************
-//		Helper method to recursively deallocate the tree.
+//		Helper method to deallocate the tree without recursion or extra 
+//	memory.  While the current node has a left child it is rotated right,
+//	and a node with no left child is deleted and its right child taken in 
+//	its place.
 //****************************************************************************
 template <class T>
 void AvlTree<T>::DestroyHelper(AvlNode<T>*& Tree)
 {
-   if (Tree != NULL)
+   while (Tree != NULL)
    {
-      DestroyHelper(Tree->left);
-      DestroyHelper(Tree->right);
-      delete Tree;
+      if (Tree->left != NULL)
+      {
+         AvlNode<T>* temp = Tree->left;
+         Tree->left = temp->right;
+         temp->right = Tree;
+         Tree = temp;
+      }
+      else
+      {
+         AvlNode<T>* temp = Tree->right;
+         delete Tree;
+         Tree = temp;
+      }
    }
-   Tree = NULL;
 }
 
 //****************************************************************************
@@ -673,6 +1007,8 @@ AvlTree<T>& AvlTree<T>::operator=(const AvlTree<T>& rightTree)
         {
 			DestroyHelper(root);
 		}
+		cursor = NULL;
+		
 		if(rightTree.root == NULL)
 		{
 			root = NULL;
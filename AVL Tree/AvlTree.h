@@ -11,9 +11,23 @@
 #include <iomanip>
 #include <cstdlib>
 #include <string>
+#include <sstream>
 #include <cmath>
+#include <vector>
+#include <utility>
+#include "FrozenTree.h"
+#include "TreePrinter.h"
 using namespace std;
 
+#define AVL_MAX_HEIGHT 96
+
+// Set to 0 to drop the size of each subtree from the nodes.  While it is
+// kept, Select, Rank and CountInRange are O(log n), otherwise they walk 
+// the keys in order.
+#ifndef AVL_ORDER_STATISTICS
+#define AVL_ORDER_STATISTICS 1
+#endif
+
 template<class T>
 class AvlTree;
 
@@ -24,29 +38,53 @@ class AvlNode
 	AvlNode* left;
 	AvlNode* right;
 	int height;
+#if AVL_ORDER_STATISTICS
+	int size = 1;
+#endif
 	
-	AvlNode(T newData): data(newData), left(NULL), right(NULL), height(0){};
+	AvlNode(T newData): data(newData), left(NULL), right(NULL), height(1){};
 
     friend class AvlTree<T>;
+    friend class TreePrinter;
 };
 
 template <class T>
 class AvlTree
 {
 public:
-    AvlTree(): root(NULL){};                 
+    AvlTree(): root(NULL), cursor(NULL){};                 
 
     void Insert(const T key) { return InsertHelper(key, root); }
 	bool Search(const T key);
 	void Delete(const T key);
 
-	void PrintTree() const;
+	void PrintTree() const { PrintTree(cout); }
+	void PrintTree(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+				   int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
+	void PrintHierarchical() const { PrintHierarchical(cout); }
+	void PrintHierarchical(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+						   int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
     void InOrder() const;
     void PreOrder() const;
     void PostOrder() const;
+    
+    template <class Visitor>
+    bool ForEachInOrder(Visitor visit) const;
+    template <class Visitor>
+    bool ForEachPreOrder(Visitor visit) const;
+    template <class Visitor>
+    bool ForEachPostOrder(Visitor visit) const;
 
     void PrintCursor() const;
     void Prune() { return PruneHelper(root); };
+    
+    int Size() const;
+    int Height() const { return GetHeight(root); }
+    bool Select(int k, T& result) const;
+    int Rank(const T key) const { return CountBelow(key, false); }
+    int CountInRange(const T low, const T high) const;
+    
+    bool Freeze(FrozenTree<T>& frozen) const;
 
     AvlTree(const AvlTree& myAvl);
     ~AvlTree();
@@ -66,17 +104,23 @@ private:
     void RotateRight(AvlNode<T>*& subtree);
     void DoubleRotateRight(AvlNode<T>*& subtree);
     
-	void DeleteHelper(const T key, AvlNode<T>*& subtree);   
+	void Rebalance(AvlNode<T>** path[], int depth);
 	AvlNode<T>* GetMin(AvlNode<T>* subtree) const;
 	
+	// Order Statistic Helper Methods.
+	int SizeOf(const AvlNode<T>* subtree) const;
+	void UpdateSize(AvlNode<T>* subtree);
+	int CountBelow(const T key, bool inclusive) const;
+	
 	void PruneHelper(AvlNode<T>* subtree);
 	bool isLeaf(AvlNode<T>* subtree) const { return (subtree->left == NULL && 
 												   subtree->right == NULL); }	
 
-	// Printing in Level Order Helper Methods.	
-	int GetHeight(AvlNode<T>* subtree) const;
-	void PrintLevel(int height) const;
-	void DispLevel(AvlNode<T>* subtree, int level, int displace) const;
+	int GetHeight(AvlNode<T>* subtree) const { return (subtree == NULL) ? 0 : 
+													  subtree->height; }
+
+	// Printing Helper Method.
+	string NodeLabel(const AvlNode<T>* subtree) const;
 	
 	// Printing in Other Order Helper Methods.	
     void PreOrderHelper(const AvlNode<T>* subtree) const; 
@@ -87,4 +131,124 @@ private:
     void DestroyHelper(AvlNode<T>*& Tree);
 };
 
+//****************************************************************************
+//		Method to call visit on every key in order, without printing 
+//	anything.  It is defined here so the callback can be any function or
+//	function object and can be inlined into the walk.  The walk stops as 
+//	soon as visit returns false, and the method returns false if it was 
+//	stopped early.
+//
+//	Parameters:
+//		visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool AvlTree<T>::ForEachInOrder(Visitor visit) const
+{
+	vector<const AvlNode<T>*> pending;
+	const AvlNode<T>* node = root;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		node = pending.back();
+		pending.pop_back();
+		
+		if (!visit(node->data))
+		{
+			return false;
+		}
+		node = node->right;
+	}
+	return true;
+}
+
+//****************************************************************************
+//		Method to call visit on every key in pre order, each node before 
+//	its children, like ForEachInOrder.
+//
+//	Parameters:
+//		visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool AvlTree<T>::ForEachPreOrder(Visitor visit) const
+{
+	vector<const AvlNode<T>*> pending;
+	
+	if (root != NULL)
+	{
+		pending.push_back(root);
+	}
+	
+	while (!pending.empty())
+	{
+		const AvlNode<T>* node = pending.back();
+		pending.pop_back();
+		
+		if (!visit(node->data))
+		{
+			return false;
+		}
+		
+		if (node->right != NULL)
+		{
+			pending.push_back(node->right);
+		}
+		if (node->left != NULL)
+		{
+			pending.push_back(node->left);
+		}
+	}
+	return true;
+}
+
+//****************************************************************************
+//		Method to call visit on every key in post order, each node after 
+//	its children, like ForEachInOrder.  A node stays on the stack until 
+//	its right subtree is done, which is known when the last node visited
+//	is its right child.
+//
+//	Parameters:
+//		visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool AvlTree<T>::ForEachPostOrder(Visitor visit) const
+{
+	vector<const AvlNode<T>*> pending;
+	const AvlNode<T>* node = root;
+	const AvlNode<T>* last = NULL;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		const AvlNode<T>* top = pending.back();
+		if (top->right != NULL && top->right != last)
+		{
+			node = top->right;
+		}
+		else
+		{
+			if (!visit(top->data))
+			{
+				return false;
+			}
+			last = top;
+			pending.pop_back();
+		}
+	}
+	return true;
+}
+
 #endif
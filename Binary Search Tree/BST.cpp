@@ -9,9 +9,14 @@
 //****************************************************************************
 //		Method to insert key into the Binary Search Tree.  If the key is
 //	already in the tree, a message will be displayed informing the user.
-//	Otherwise, the method will try to allocate memory for a new node.  If
-//	it is successful the insertion will proceed, otherwise the exception
-//	will be caught and an appropriate message displayed.
+//	Otherwise, the method will walk down to the empty link where the key
+//	belongs and try to allocate memory for a new node there.  If it is 
+//	successful the insertion will proceed, otherwise the exception will be 
+//	caught and an appropriate message displayed.  The walk is a loop, so a 
+//	tree that has degenerated into a list cannot overflow the stack.  When
+//	subtree sizes are kept, they are counted up along the path afterwards.
+//	In the scapegoat mode, a key deeper than log base 1/alpha of the size
+//	of the tree has a subtree above it rebuilt.
 //
 //	Parameters:
 //		key: the key to be inserted.
@@ -20,421 +25,1217 @@
 template <class T>
 void BST<T>::InsertHelper(const T key, BNode<T>*& subtree)
 {
-	if (subtree)
-    {
-        if (key < subtree->data)
-        {
-		    return InsertHelper(key, subtree->left);
+	BNode<T>** link  = &subtree;
+	int        depth = 0;
+	
+	while (*link != NULL)
+	{
+		depth++;
+		
+		if (key < (*link)->data)
+		{
+			link = &(*link)->left;
 		}
-        else if (key > subtree->data)
-        {
-		    return InsertHelper(key, subtree->right);
+		else if (key > (*link)->data)
+		{
+			link = &(*link)->right;
 		}
-        else
-        {
-		    cerr << "No duplicates allowed, please try again." << endl;
+		else
+		{
+			cerr << "No duplicates allowed, please try again." << endl;
+			cursor = *link;
+			return;
+		}
+	}
+	
+	try
+	{
+		*link = new BNode<T>(key);
+		AdjustSizes(key, 1);
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to insert " << key << " into the tree due to";
+		cerr << " bad memory allocation." << endl;
+		return;
+	}
+	
+	cursor = *link;
+	nodeCount++;
+	maxNodeCount = max(maxNodeCount, nodeCount);
+	
+	if (alpha > 0 && depth > log((double)nodeCount) / log(1.0 / alpha))
+	{
+		RebuildScapegoat(key);
+	}
+}
+
+//****************************************************************************
+//		Method to restore the scapegoat height bound after an insertion has
+//	left the new key too deep.  The path down to the key is walked again, 
+//	and going back up it, each subtree size is the size of the child just
+//	left plus the node and its other child.  The first ancestor with a 
+//	child holding more than alpha of its nodes is the scapegoat, and its 
+//	subtree is rebuilt into a balanced one in place.  Sizes are counted
+//	by walking the sibling subtrees, which costs no more than the rebuild.
+//
+//	Parameters:
+//		key: the key that was just inserted.
+//****************************************************************************
+template <class T>
+void BST<T>::RebuildScapegoat(const T key)
+{
+	vector<BNode<T>**> path;
+	BNode<T>**         link = &root;
+	
+	while (!((*link)->data == key))
+	{
+		path.push_back(link);
+		link = (key < (*link)->data) ? &(*link)->left : &(*link)->right;
+	}
+	
+	int childSize = 1;
+	
+	for (int i = (int)path.size() - 1; i >= 0; i--)
+	{
+		BNode<T>* node    = *path[i];
+		BNode<T>* sibling = (key < node->data) ? node->right : node->left;
+		int       size    = childSize + 1 + CountNodes(sibling);
+		
+		if (childSize > alpha * size)
+		{
+			VineToTree(*path[i], TreeToVine(*path[i]));
+			return;
+		}
+		childSize = size;
+	}
+}
+
+//****************************************************************************
+//		Method to return the number of nodes in a subtree.  The stored size 
+//	is used when subtree sizes are kept, otherwise the nodes are counted.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+int BST<T>::CountNodes(const BNode<T>* subtree) const
+{
+#if BST_ORDER_STATISTICS
+	return SizeOf(subtree);
+#else
+	vector<const BNode<T>*> pending;
+	int count = 0;
+	
+	if (subtree != NULL)
+	{
+		pending.push_back(subtree);
+	}
+	while (!pending.empty())
+	{
+		const BNode<T>* node = pending.back();
+		pending.pop_back();
+		count++;
+		
+		if (node->left != NULL)
+		{
+			pending.push_back(node->left);
+		}
+		if (node->right != NULL)
+		{
+			pending.push_back(node->right);
+		}
+	}
+	return count;
+#endif
+}
+
+//****************************************************************************
+//		Method to turn on the scapegoat mode with the given weight balance,
+//	which must be between 0.5 and 1.  Lower values keep the tree closer to 
+//	perfectly balanced at the cost of more frequent rebuilds.  The tree is
+//	rebalanced so the height bound holds from the start.  The mode adds no
+//	fields to the nodes, only the counters kept by the tree.
+//
+//	Parameters:
+//		newAlpha: the weight balance to keep.
+//****************************************************************************
+template <class T>
+void BST<T>::EnableScapegoat(double newAlpha)
+{
+	if (newAlpha <= 0.5 || newAlpha >= 1)
+	{
+		cerr << "The scapegoat alpha must be between 0.5 and 1." << endl;
+		return;
+	}
+	
+	alpha = newAlpha;
+	maxNodeCount = nodeCount;
+	Rebalance();
+}
+
+//****************************************************************************
+//		Method to return the number of levels in the tree, found with a 
+//	level by level walk.
+//
+//	Parameters: N/A.
+//****************************************************************************
+template <class T>
+int BST<T>::Height() const
+{
+	vector<const BNode<T>*> level;
+	vector<const BNode<T>*> next;
+	int height = 0;
+	
+	if (root != NULL)
+	{
+		level.push_back(root);
+	}
+	
+	while (!level.empty())
+	{
+		height++;
+		next.clear();
+		
+		for (size_t i = 0; i < level.size(); i++)
+		{
+			if (level[i]->left != NULL)
+			{
+				next.push_back(level[i]->left);
+			}
+			if (level[i]->right != NULL)
+			{
+				next.push_back(level[i]->right);
+			}
+		}
+		level.swap(next);
+	}
+	return height;
+}
+
+//****************************************************************************
+//		Method to search for a given key within the Binary Search Tree.
+//	The method will traverse the tree based on the value of the key.  If it
+//	is found, the cursor is moved to it and the method will return true.  
+//	Otherwise, the method will return false.
+//
+//	Parameters:
+//		key: the key to be searched for.
+//****************************************************************************
+template <class T>
+bool BST<T>::Search(const T key)
+{
+	BNode<T>* temp = root;
+	
+	while (temp != NULL)
+	{
+		nodesVisited = nodesVisited + 1;
+		
+		if (key < temp->data)
+		{
+			temp = temp->left;
+		}
+		else if (key > temp->data)
+		{
+			temp = temp->right;
+		}
+		else
+		{
+			cursor = temp;
+			return true;
+		}
+	}
+	return false;
+}
+
+//****************************************************************************
+//		Method to delete a given key from the Binary Search Tree in a single
+//	walk down the tree.  The walk keeps the link that points at the current
+//	node, so the node can be unlinked without a second search for its 
+//	parent.  If the node has no children, it is simply removed.  If it has
+//	one child, the child takes its place.  If it has both children, the 
+//	walk continues to the smallest key of the right subtree, which is moved
+//	into the node and its own node unlinked.  
+//
+//	Afterwards the cursor is on the node that took the deleted key's place,
+//	or on the parent if a leaf was removed.  If the key cannot be found, a
+//	message will be displayed and false returned.  When subtree sizes are 
+//	kept, they are counted down along the path once the key is found.  In
+//	the scapegoat mode, the whole tree is rebuilt once deletions have taken
+//	it below alpha of the largest size it has had since the last rebuild.
+//
+//	Parameters:
+//		key: the key to be deleted.
+//****************************************************************************
+template <class T>
+bool BST<T>::Delete(const T key)
+{
+	BNode<T>*  parent = NULL;
+	BNode<T>** link   = &root;
+	BNode<T>*  node   = root;
+	
+	while (node != NULL)
+	{
+		nodesVisited = nodesVisited + 1;
+		
+		if (key < node->data)
+		{
+			link = &node->left;
+		}
+		else if (key > node->data)
+		{
+			link = &node->right;
+		}
+		else
+		{
+			break;
+		}
+		parent = node;
+		node = *link;
+	}
+	
+	if (node == NULL)
+	{
+		cerr << "There is not a node with value: " << key << endl;
+		return false;
+	}
+	
+	if (node->left != NULL && node->right != NULL)
+	{
+		AdjustSizes(key, -1);
+		
+		BNode<T>** minLink = &node->right;
+		BNode<T>*  minNode = node->right;
+		
+		nodesVisited = nodesVisited + 1;
+		while (minNode->left != NULL)
+		{
+			minLink = &minNode->left;
+			minNode = minNode->left;
+			nodesVisited = nodesVisited + 1;
+		}
+		
+#if BST_ORDER_STATISTICS
+		node->size--;
+		for (BNode<T>* temp = node->right; temp != minNode; temp = temp->left)
+		{
+			temp->size--;
+		}
+#endif
+		node->data = minNode->data;
+		*minLink = minNode->right;
+		delete minNode;
+		cursor = node;
+	}
+	else
+	{
+		BNode<T>* child = (node->left != NULL) ? node->left : node->right;
+		
+		AdjustSizes(key, -1);
+		*link = child;
+		delete node;
+		cursor = (child != NULL) ? child : parent;
+	}
+	
+	nodeCount--;
+	if (alpha > 0 && nodeCount < alpha * maxNodeCount)
+	{
+		Rebalance();
+		maxNodeCount = nodeCount;
+	}
+	return true;
+}
+
+//****************************************************************************
+//		Helper method to remove every leaf from the tree, except the root.
+//	Each node on an explicit stack checks its children, and a child that is
+//	a leaf is deleted and its link cleared, otherwise the child is pushed to
+//	be checked in turn.  The cursor is left on the parent of the last leaf
+//	removed.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+void BST<T>::PruneHelper(BNode<T>* subtree)
+{
+	if (subtree == NULL || isLeaf(subtree))
+	{
+		return;
+	}
+	
+	vector<BNode<T>*> pending;
+	pending.push_back(subtree);
+	
+	while (!pending.empty())
+	{
+		BNode<T>* node = pending.back();
+		pending.pop_back();
+		
+		BNode<T>** links[2] = { &node->left, &node->right };
+		for (int i = 0; i < 2; i++)
+		{
+			BNode<T>* child = *links[i];
+			
+			if (child == NULL)
+			{
+				continue;
+			}
+			if (isLeaf(child))
+			{
+				delete child;
+				*links[i] = NULL;
+				cursor = node;
+				nodeCount--;
+			}
+			else
+			{
+				pending.push_back(child);
+			}
+		}
+	}
+	RecountSizes();
+}
+
+//****************************************************************************
+//		Method to return a pointer to the left most value in the tree.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+BNode<T>* BST<T>::GetMin(BNode<T>* subtree) const
+{
+	while(subtree->left != NULL) 
+	{
+		subtree = subtree->left;
+	}
+	return subtree;
+}
+
+//****************************************************************************
+//		Method to replace the contents of the tree with the given keys, 
+//	building a tree of the smallest possible height in O(n).  The keys are
+//	sorted first if they are not already in order, and repeated keys are
+//	skipped.  One node is allocated per key, in order, and linked into a 
+//	vine down the right links, which VineToTree then folds into a balanced
+//	tree in place.  If an allocation fails, the tree is left empty.
+//
+//	Parameters:
+//		keys: the keys to be loaded.
+//		numKeys: the number of keys.
+//****************************************************************************
+template <class T>
+void BST<T>::BulkLoad(const T* keys, int numKeys)
+{
+	DestroyHelper(root);
+	cursor = NULL;
+	nodeCount = 0;
+	maxNodeCount = 0;
+	
+	if (keys == NULL || numKeys <= 0)
+	{
+		return;
+	}
+	
+	BNode<T>** link   = &root;
+	int        size   = 0;
+	T*         sorted = NULL;
+	
+	try
+	{
+		for (int i = 1; i < numKeys; i++)
+		{
+			if (keys[i] < keys[i - 1])
+			{
+				sorted = new T[numKeys];
+				copy(keys, keys + numKeys, sorted);
+				sort(sorted, sorted + numKeys);
+				keys = sorted;
+				break;
+			}
+		}
+		
+		for (int i = 0; i < numKeys; i++)
+		{
+			if (i > 0 && !(keys[i - 1] < keys[i]))
+			{
+				continue;
+			}
+			
+			*link = new BNode<T>(keys[i]);
+			link = &(*link)->right;
+			size++;
+		}
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to load " << numKeys << " keys into the tree due to";
+		cerr << " bad memory allocation." << endl;
+		DestroyHelper(root);
+		delete [] sorted;
+		return;
+	}
+	
+	delete [] sorted;
+	
+#if BST_ORDER_STATISTICS
+	int remaining = size;
+	for (BNode<T>* node = root; node != NULL; node = node->right)
+	{
+		node->size = remaining--;
+	}
+#endif
+	nodeCount = size;
+	maxNodeCount = size;
+	VineToTree(root, size);
+}
+
+//****************************************************************************
+//		Method to balance the tree in place with the Day-Stout-Warren 
+//	algorithm.  The tree is rotated into a vine and the vine folded back 
+//	into a tree of the smallest possible height, in O(n) time and without 
+//	any extra memory.  The nodes themselves are not moved, so the cursor 
+//	stays on its key.
+//
+//	Parameters: N/A.
+//****************************************************************************
+template <class T>
+void BST<T>::Rebalance()
+{
+	VineToTree(root, TreeToVine(root));
+}
+
+//****************************************************************************
+//		Method to export the keys into a read only frozen tree, replacing 
+//	anything it held.  The frozen tree does not change with later inserts 
+//	or deletes.  If a bad allocation error is detected, a message will be 
+//	displayed and false returned.
+//
+//	Parameters:
+//		frozen: the frozen tree to fill.
+//****************************************************************************
+template <class T>
+bool BST<T>::Freeze(FrozenTree<T>& frozen) const
+{
+	T* keys = NULL;
+	try
+	{
+		keys = new T[nodeCount > 0 ? nodeCount : 1];
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to freeze the Binary Search Tree." << endl;
+		frozen.Clear();
+		return false;
+	}
+	
+	int numKeys = 0;
+	ForEachInOrder([&](const T& key)
+	{
+		keys[numKeys++] = key;
+		return true;
+	});
+	
+	bool built = frozen.Build(keys, numKeys);
+	delete[] keys;
+	return built;
+}
+
+//****************************************************************************
+//		Helper method to rotate a subtree right at every node with a left 
+//	child, until it is a vine in order down the right links.  Returns the 
+//	number of nodes in the vine.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+int BST<T>::TreeToVine(BNode<T>*& subtree)
+{
+	BNode<T>** link = &subtree;
+	int        size = 0;
+	
+	while (*link != NULL)
+	{
+		if ((*link)->left != NULL)
+		{
+			BNode<T>* temp = (*link)->left;
+			(*link)->left = temp->right;
+			temp->right = *link;
+			*link = temp;
+			
+			UpdateSize(temp->right);
+			UpdateSize(temp);
+		}
+		else
+		{
+			size++;
+			link = &(*link)->right;
+		}
+	}
+	return size;
+}
+
+//****************************************************************************
+//		Helper method to fold a vine of the given size into a balanced tree.
+//	The first pass moves the nodes that will form the partial bottom level
+//	out of the way, and each pass after it halves the length of the vine
+//	until it is a single node.
+//
+//	Parameters:
+//		subtree: pointer to the head of the vine.
+//		size: the number of nodes in the vine.
+//****************************************************************************
+template <class T>
+void BST<T>::VineToTree(BNode<T>*& subtree, int size)
+{
+	int fullSize = 1;
+	while (fullSize <= size + 1)
+	{
+		fullSize = fullSize * 2;
+	}
+	fullSize = fullSize / 2 - 1;
+	
+	Compress(subtree, size - fullSize);
+	
+	while (fullSize > 1)
+	{
+		fullSize = fullSize / 2;
+		Compress(subtree, fullSize);
+	}
+}
+
+//****************************************************************************
+//		Helper method to rotate left at every other node down the right 
+//	links, starting from the head of the vine, the given number of times.
+//
+//	Parameters:
+//		subtree: pointer to the head of the vine.
+//		count: the number of rotations to perform.
+//****************************************************************************
+template <class T>
+void BST<T>::Compress(BNode<T>*& subtree, int count)
+{
+	BNode<T>** link = &subtree;
+	
+	for (int i = 0; i < count; i++)
+	{
+		BNode<T>* child = *link;
+		BNode<T>* next  = child->right;
+		
+		child->right = next->left;
+		next->left = child;
+		*link = next;
+		link = &next->right;
+		
+		UpdateSize(child);
+		UpdateSize(next);
+	}
+}
+
+//****************************************************************************
+//		Method to find the key with k smaller keys in the tree, counting from
+//	zero.  When subtree sizes are kept, each step compares k with the size 
+//	of the left subtree and the walk is a single path down the tree.  
+//	Otherwise the keys are stepped through in order.  If k is out of range,
+//	the method will return false.
+//
+//	Parameters:
+//		k: the position of the key in order.
+//		result: receives the key that was found.
+//****************************************************************************
+template <class T>
+bool BST<T>::Select(int k, T& result) const
+{
+	if (k < 0)
+	{
+		return false;
+	}
+	
+#if BST_ORDER_STATISTICS
+	const BNode<T>* node = root;
+	
+	while (node != NULL)
+	{
+		int leftSize = SizeOf(node->left);
+		
+		if (k < leftSize)
+		{
+			node = node->left;
+		}
+		else if (k == leftSize)
+		{
+			result = node->data;
+			return true;
+		}
+		else
+		{
+			k = k - leftSize - 1;
+			node = node->right;
+		}
+	}
+	return false;
+#else
+	iterator it = begin();
+	for ( ; it != end() && k > 0; ++it)
+	{
+		k--;
+	}
+	
+	if (it == end())
+	{
+		return false;
+	}
+	result = *it;
+	return true;
+#endif
+}
+
+//****************************************************************************
+//		Method to return the number of keys in the tree that are less than
+//	the given key, which is also its position in order when it is present.
+//
+//	Parameters:
+//		key: the key to be ranked.
+//****************************************************************************
+template <class T>
+int BST<T>::Rank(const T key) const
+{
+#if BST_ORDER_STATISTICS
+	const BNode<T>* node = root;
+	int rank = 0;
+	
+	while (node != NULL)
+	{
+		if (node->data < key)
+		{
+			rank = rank + SizeOf(node->left) + 1;
+			node = node->right;
+		}
+		else
+		{
+			node = node->left;
+		}
+	}
+	return rank;
+#else
+	int rank = 0;
+	for (iterator it = begin(); it != end() && *it < key; ++it)
+	{
+		rank++;
+	}
+	return rank;
+#endif
+}
+
+//****************************************************************************
+//		Method to return the number of keys from low to high, inclusive.
+//	When subtree sizes are kept, this is the difference of two ranks.  
+//	Otherwise the keys in the range are counted with Range.
+//
+//	Parameters:
+//		low: the smallest key to count.
+//		high: the largest key to count.
+//****************************************************************************
+template <class T>
+int BST<T>::CountInRange(const T low, const T high) const
+{
+	if (high < low)
+	{
+		return 0;
+	}
+	
+#if BST_ORDER_STATISTICS
+	const BNode<T>* node = root;
+	int notAbove = 0;
+	
+	while (node != NULL)
+	{
+		if (high < node->data)
+		{
+			node = node->left;
+		}
+		else
+		{
+			notAbove = notAbove + SizeOf(node->left) + 1;
+			node = node->right;
+		}
+	}
+	return notAbove - Rank(low);
+#else
+	return Range(low, high, [](const T&) {});
+#endif
+}
+
+//****************************************************************************
+//		Method to return the number of nodes in a subtree, or zero if sizes
+//	are not kept.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+int BST<T>::SizeOf(const BNode<T>* subtree) const
+{
+#if BST_ORDER_STATISTICS
+	return (subtree == NULL) ? 0 : subtree->size;
+#else
+	(void)subtree;
+	return 0;
+#endif
+}
+
+//****************************************************************************
+//		Method to recompute the size of a node from its children, after a 
+//	rotation has changed them.
+//
+//	Parameters:
+//		subtree: pointer to the root of subtree.
+//****************************************************************************
+template <class T>
+void BST<T>::UpdateSize(BNode<T>* subtree)
+{
+#if BST_ORDER_STATISTICS
+	subtree->size = SizeOf(subtree->left) + SizeOf(subtree->right) + 1;
+#else
+	(void)subtree;
+#endif
+}
+
+//****************************************************************************
+//		Method to add delta to the size of every node on the path from the
+//	root towards the given key, stopping before the node that holds it.
+//
+//	Parameters:
+//		key: the key whose path is adjusted.
+//		delta: the amount to add to each size.
+//****************************************************************************
+template <class T>
+void BST<T>::AdjustSizes(const T key, int delta)
+{
+#if BST_ORDER_STATISTICS
+	BNode<T>* node = root;
+	
+	while (node != NULL && !(node->data == key))
+	{
+		node->size = node->size + delta;
+		node = (key < node->data) ? node->left : node->right;
+	}
+#else
+	(void)key;
+	(void)delta;
+#endif
+}
+
+//****************************************************************************
+//		Method to recompute the size of every node, children before their 
+//	parents, after a change too broad to adjust along one path.
+//
+//	Parameters: N/A.
+//****************************************************************************
+template <class T>
+void BST<T>::RecountSizes()
+{
+#if BST_ORDER_STATISTICS
+	vector<BNode<T>*> pending;
+	BNode<T>* node = root;
+	BNode<T>* lastCounted = NULL;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		BNode<T>* top = pending.back();
+		
+		if (top->right != NULL && top->right != lastCounted)
+		{
+			node = top->right;
+			continue;
+		}
+		
+		UpdateSize(top);
+		lastCounted = top;
+		pending.pop_back();
+	}
+#endif
+}
+
+//****************************************************************************
+//		Method to return an iterator to the smallest key in the tree, or 
+//	the end iterator if the tree is empty.
+//
+//	Parameters: N/A.
+//****************************************************************************
+template <class T>
+BSTIterator<T> BST<T>::begin() const
+{
+	iterator it(root);
+	
+	for (BNode<T>* node = root; node != NULL; node = node->left)
+	{
+		it.path.push_back(node);
+	}
+	return it;
+}
+
+//****************************************************************************
+//		Method to return an iterator to the first key that is not less than
+//	the given key, or the end iterator if there is none.  The walk keeps
+//	the path it takes and cuts it back to the last node where it turned 
+//	left, since that node is the answer when the walk falls off the tree.
+//
+//	Parameters:
+//		key: the key to be searched for.
+//****************************************************************************
+template <class T>
+BSTIterator<T> BST<T>::LowerBound(const T key) const
+{
+	iterator it(root);
+	size_t   found = 0;
+	
+	for (BNode<T>* node = root; node != NULL; )
+	{
+		it.path.push_back(node);
+		
+		if (node->data < key)
+		{
+			node = node->right;
 		}
-    }
-    else
-    {
-    	try
-    	{
-    		subtree = new BNode<T>(key);
-    	}
-    	catch (bad_alloc & ex)
-    	{
-    		cerr << "Failed to insert " << key << " into the tree due to";
-    		cerr << " bad memory allocation." << endl;
+		else
+		{
+			found = it.path.size();
+			node = node->left;
 		}
 	}
-    
-	cursor = subtree;
+	it.path.resize(found);
+	return it;
 }
 
 //****************************************************************************
-//		Method to search for a given key within the Binary Search Tree.
-//	The method will traverse the tree based on the value of the key.  If it
-//	is found, the method will return true.  Otherwise, the method will 
-//	return false.
+//		Method to return an iterator to the first key that is greater than
+//	the given key, or the end iterator if there is none.
 //
 //	Parameters:
 //		key: the key to be searched for.
 //****************************************************************************
 template <class T>
-bool BST<T>::Search(const T key)
+BSTIterator<T> BST<T>::UpperBound(const T key) const
 {
-	BNode<T>* temp = root;
+	iterator it(root);
+	size_t   found = 0;
 	
-	while (temp != NULL)
+	for (BNode<T>* node = root; node != NULL; )
 	{
-		if (key < temp->data)
-		{
-			if (temp->left == NULL)
-			{
-				return false;
-			}
-			else
-			{
-				temp = temp->left;
-			}
-		}
-		else if (key == temp->data)
+		it.path.push_back(node);
+		
+		if (key < node->data)
 		{
-			cursor = temp;
-			return true;
+			found = it.path.size();
+			node = node->left;
 		}
 		else
 		{
-			if (temp->right == NULL)
-			{
-				return false;
-			}
-			else
-			{
-				temp = temp->right;
-			}
+			node = node->right;
 		}
 	}
+	it.path.resize(found);
+	return it;
 }
 
 //****************************************************************************
-//		Method to delete a given key into the Binary Search Tree.  If this
-//	method is called on an empty tree, it will return.  If the key cannot be
-//	found within the tree, a message will be displayed to the user.  
-//	Otherwise, the method will proceed with deletion in the helper function.
+//		Method to find the largest key that is not greater than the given 
+//	key.  If there is one, it is stored in result and true returned.  
+//	Otherwise, the method will return false.
 //
 //	Parameters:
-//		key: the key to be deleted.
+//		key: the key to be searched for.
+//		result: receives the key that was found.
 //****************************************************************************
 template <class T>
-void BST<T>::Delete(const T key)
+bool BST<T>::Floor(const T key, T& result) const
 {
-	if (root == NULL)
-	{
-		return;
-	}
-	
-	bool isFound = Search(key);
+	const BNode<T>* found = NULL;
 	
-	if (isFound == false)
+	for (const BNode<T>* node = root; node != NULL; )
 	{
-		cerr << "There is not a node with value: " << key << endl;
-	}
-	else 
-	{
-		DeleteHelper(key, root);
+		if (key < node->data)
+		{
+			node = node->left;
+		}
+		else
+		{
+			found = node;
+			node = node->right;
+		}
 	}
 	
-	if (root == NULL)
+	if (found == NULL)
 	{
-		cursor = NULL;
+		return false;
 	}
+	result = found->data;
+	return true;
 }
 
 //****************************************************************************
-//		Helper method to delete a node with a given key.  This method will
-//	traverse the tree until it has found the node with the key to be 
-//	deleted.  If the node has no children, it will simply be deleted.  If
-//	the node has one child, the data from the child will take its place
-//	and the child deleted.  If the node has both children, then the node
-//	will swap data values with the value that is returned from the 
-//	GetMin function.  
+//		Method to find the smallest key that is not less than the given 
+//	key.  If there is one, it is stored in result and true returned.  
+//	Otherwise, the method will return false.
 //
 //	Parameters:
-//		key: the key to be deleted.
-//		subtree: pointer to the root of subtree.
+//		key: the key to be searched for.
+//		result: receives the key that was found.
 //****************************************************************************
 template <class T>
-BNode<T>* BST<T>::DeleteHelper(const T key, BNode<T>*& subtree)
+bool BST<T>::Ceiling(const T key, T& result) const
 {
-	if (subtree == NULL)
-	{
-		return subtree;
-	}
+	const BNode<T>* found = NULL;
 	
-	if (key < subtree->data)
+	for (const BNode<T>* node = root; node != NULL; )
 	{
-		subtree->left = DeleteHelper(key, subtree->left);
-	}
-	else if (key > subtree->data)
-	{
-		subtree->right = DeleteHelper(key, subtree->right);
-	}
-	else
-	{
-		if (subtree->left == NULL && subtree->right == NULL)
-		{
-			BNode<T>* parent = NULL;
-			if (parent = GetParent(subtree))
-			{
-				cursor = parent;
-			}
-
-			delete subtree;
-			subtree = NULL;
-		}
-			
-		else if (subtree->left == NULL)
-		{
-			BNode<T>* temp = subtree;
-			subtree = subtree->right;
-			cursor = subtree;
-			delete temp;
-		}
-		else if (subtree->right == NULL)
+		if (node->data < key)
 		{
-			BNode<T>* temp = subtree;
-			subtree = subtree->left;
-			cursor = subtree;
-			delete temp;
+			node = node->right;
 		}
 		else
 		{
-			BNode<T>* temp = GetMin(subtree->right);
-			subtree->data = temp->data;
-			
-			if (subtree->left)
-			{
-				cursor = subtree->left;
-			}
-			else if (subtree->right)
-			{
-				cursor = subtree->right;
-			}
-				
-			subtree->right = DeleteHelper(temp->data, subtree->right);
+			found = node;
+			node = node->left;
 		}
 	}
-	return subtree;
+	
+	if (found == NULL)
+	{
+		return false;
+	}
+	result = found->data;
+	return true;
 }
 
 //****************************************************************************
-//		Helper method to traverse the tree and check each node to see if it
-//	is a leaf.  If it is, the deletion method will be called on that node.
-//	Otherwise, the traversal will continue until the entire tree has been
-//	pruned of leaves.  
+//		Method to find the smallest key in the tree.  If the tree is empty,
+//	the method will return false.
 //
 //	Parameters:
-//		subtree: pointer to the root of subtree.
+//		result: receives the smallest key.
 //****************************************************************************
 template <class T>
-void BST<T>::PruneHelper(BNode<T>* subtree)
+bool BST<T>::Min(T& result) const
 {
-    if (subtree != NULL)
-    {
-        PruneHelper(subtree->left);
-        
-        if (isLeaf(subtree) && subtree != root)
-        {
-        	Delete(subtree->data);
-		}
-			
-        PruneHelper(subtree->right);
-    }	
+	if (root == NULL)
+	{
+		return false;
+	}
+	result = GetMin(root)->data;
+	return true;
 }
 
 //****************************************************************************
-//		Method to return a pointer to the left most value in the tree.
+//		Method to find the largest key in the tree.  If the tree is empty,
+//	the method will return false.
 //
 //	Parameters:
-//		subtree: pointer to the root of subtree.
+//		result: receives the largest key.
 //****************************************************************************
 template <class T>
-BNode<T>* BST<T>::GetMin(BNode<T>* subtree) const
+bool BST<T>::Max(T& result) const
 {
-	while(subtree->left != NULL) 
+	if (root == NULL)
 	{
-		subtree = subtree->left;
+		return false;
 	}
-	return subtree;
+	
+	const BNode<T>* node = root;
+	while (node->right != NULL)
+	{
+		node = node->right;
+	}
+	result = node->data;
+	return true;
 }
 
 //****************************************************************************
-//		Method to traverse the tree and return the address of the parent
-//	of the caller.  
+//		Method to step the iterator to the next key.  If the node has a 
+//	right subtree, the next key is the leftmost node of it.  Otherwise, the
+//	path is unwound past every node that was reached from the right, and 
+//	the node left on top is the next key.  Stepping past the largest key 
+//	gives the end iterator.
 //
-//	Parameters:
-//		subtree: pointer to the root of subtree.
+//	Parameters: N/A.
 //****************************************************************************
 template <class T>
-BNode<T>* BST<T>::GetParent(BNode<T>* subtree) const
+BSTIterator<T>& BSTIterator<T>::operator++()
 {
-	BNode<T>* parent = NULL;
-	BNode<T>* top = root;
-
-	while (top != NULL && top != subtree)
+	if (path.empty())
 	{
-		if (top != subtree)
-		{
-			parent = top;
-		}
-		
-		if (top->data > subtree->data)
+		return *this;
+	}
+	
+	BNode<T>* node = path.back();
+	
+	if (node->right != NULL)
+	{
+		for (node = node->right; node != NULL; node = node->left)
 		{
-			top = top->left;
+			path.push_back(node);
 		}
-		else
+	}
+	else
+	{
+		path.pop_back();
+		while (!path.empty() && path.back()->right == node)
 		{
-			top = top->right;
+			node = path.back();
+			path.pop_back();
 		}
 	}
-	return parent;
+	return *this;
 }
 
 //****************************************************************************
-//		Method to print the tree in level order.
-//
-//	Parameters: N/A.
+//		Post-increment operator.
 //****************************************************************************
 template <class T>
-void BST<T>::PrintTree() const
+BSTIterator<T> BSTIterator<T>::operator++(int)
 {
-	if (!root)
-	{
-        return;
-    }
-    else
-    {
-        int ctr = 0;
-        while (ctr <= TreeHeight(root))
-        {
-            PrintLevel(ctr);
-            ctr++;
-            cout << endl << endl;
-        }
-    }
+	BSTIterator<T> previous(*this);
+	++(*this);
+	return previous;
 }
 
 //****************************************************************************
-//		Recursively calculates the height of the tree.
+//		Method to step the iterator to the previous key, the mirror image
+//	of operator++.  Stepping back from the end iterator gives the largest 
+//	key, and stepping back from the smallest key gives the end iterator.
 //
-//	Parameters:
-//		subtree: pointer to the root of subtree.
+//	Parameters: N/A.
 //****************************************************************************
 template <class T>
-int BST<T>::TreeHeight(BNode<T>* subtree) const
+BSTIterator<T>& BSTIterator<T>::operator--()
 {
-	if (subtree == NULL)
+	BNode<T>* node;
+	
+	if (path.empty())
 	{
-		return 0;
+		for (node = root; node != NULL; node = node->right)
+		{
+			path.push_back(node);
+		}
+		return *this;
 	}
-	else
+	
+	node = path.back();
+	
+	if (node->left != NULL)
 	{
-		int leftHeight = TreeHeight(subtree->left);
-		int rightHeight = TreeHeight(subtree->right);
-		
-		if (leftHeight >= rightHeight)
+		for (node = node->left; node != NULL; node = node->right)
 		{
-			return leftHeight + 1;
+			path.push_back(node);
 		}
-		else
+	}
+	else
+	{
+		path.pop_back();
+		while (!path.empty() && path.back()->left == node)
 		{
-			return rightHeight + 1;
+			node = path.back();
+			path.pop_back();
 		}
 	}
+	return *this;
 }
 
 //****************************************************************************
-//		Calculates width to space out nodes and calls DispLevel to print
-//	nodes on given level.
-//
-//	Parameters:
-//		height: height of tree.
+//		Post-decrement operator.
 //****************************************************************************
 template <class T>
-void BST<T>::PrintLevel(int height) const
+BSTIterator<T> BSTIterator<T>::operator--(int)
 {
-	BNode<T>* temp = root;
-	
-	// leftmost point
-	int value = pow(2, TreeHeight(root) - height + 2);
-	cout << setw(value) << "";
-	DispLevel(temp, height, value);
+	BSTIterator<T> previous(*this);
+	--(*this);
+	return previous;
+}
+
+//****************************************************************************
+//		Two iterators are equal when they belong to the same tree and are on
+//	the same node, or are both the end iterator.
+//****************************************************************************
+template <class T>
+bool BSTIterator<T>::operator==(const BSTIterator<T>& other) const
+{
+	if (root != other.root || path.empty() != other.path.empty())
+	{
+		return false;
+	}
+	return path.empty() || path.back() == other.path.back();
 }
 
 //****************************************************************************
-//		Displays the nodes on given level and will display 'x' where the
-//	pointers are NULL.
+//		Method to print the tree in level order.  The tree is walked once,
+//	so this is O(n) in the nodes shown, and the text is written to the 
+//	stream in large blocks.  By default the whole tree is printed.  If 
+//	maxDepth or maxWidth is positive, levels past maxDepth are left out and
+//	lines are cut at maxWidth characters.
 //
 //	Parameters:
-//		subtree: node to be displayed.
-//		level: current level.
-//		displace: displacement.
+//		out: the stream to print to, such as cout or an ofstream.
+//		maxDepth: the most levels to print, or 0 for no limit.
+//		maxWidth: the most characters on a line, or 0 for no limit.
 //****************************************************************************
 template <class T>
-void BST<T>::DispLevel(BNode<T>* subtree, int level, int displace) const
+void BST<T>::PrintTree(ostream& out, int maxDepth, int maxWidth) const
 {
-	int disp = 2 * displace;
-	if (level == 0)
+	TreePrinter printer(out, maxDepth, maxWidth);
+	printer.PrintLevels(root, [this](const BNode<T>* subtree)
 	{
-		if (subtree == NULL)
-		{
-			cout << " x ";
-			cout << setw(disp - 3) << "";
-			return;
-		}
-		else
-		{
-			int result = ((subtree->data <= 1) ? 1: log10(subtree->data) + 1);
-			if (subtree == cursor)
-			{
-				cout << "[" << subtree->data << "]";
-			}
-			else
-			{
-				cout << subtree->data;
-			}
+		return NodeLabel(subtree);
+	});
+}
 
-			cout << setw(disp - result) << "";
-		}
-	}
-	
-	else
+//****************************************************************************
+//		Method for printing contents of the tree to resemble a file tree,
+//	with the same limits as PrintTree.
+//
+//	Parameters:
+//		out: the stream to print to, such as cout or an ofstream.
+//		maxDepth: the most levels to print, or 0 for no limit.
+//		maxWidth: the most characters on a line, or 0 for no limit.
+//****************************************************************************
+template <class T>
+void BST<T>::PrintHierarchical(ostream& out, int maxDepth, int maxWidth) const
+{
+	TreePrinter printer(out, maxDepth, maxWidth);
+	printer.PrintHierarchical(root, [this](const BNode<T>* subtree)
 	{
-		if (subtree == NULL && level >= 1)
-		{
-			DispLevel(NULL, level - 1, displace);
-			DispLevel(NULL, level - 1, displace);
-		}
-		else
-		{
-			DispLevel(subtree->left, level - 1, displace);
-			DispLevel(subtree->right, level - 1, displace);
-		}
-	}
+		return NodeLabel(subtree);
+	});
 }
 
 //****************************************************************************
-//		Helper method for printing contents of the tree to resemble a file 
-//  tree. 
+//		Helper method to return the text shown for a node by the printers.
+//	The node the cursor references is shown in brackets.
 //
 //	Parameters:
 //		subtree: node to be displayed.
-//		indent: the given indention spacing.
-//		isLeft: boolean of if node is left child.
 //****************************************************************************
 template <class T>
-void BST<T>::PrintHierarchicalHelper(BNode<T>* subtree, bool isLeft, const std::string& indent) const
+string BST<T>::NodeLabel(const BNode<T>* subtree) const
 {
-	if (subtree == NULL) 
+	ostringstream text;
+	if (subtree == cursor)
 	{
-		return;
+		text << "[" << subtree->data << "]";
 	}
 	else
 	{
-	    std::cout << indent;
-
-        // Use different branches for left vs right children.
-        std::cout << (isLeft ? "|-- " : "L-- ");
-
-        // Print the node's value.
-        std::cout << subtree->data << std::endl;
-
-        // Update the prefix for the next level: 
-        // If we are on a left branch, add a vertical bar for the right branch later.
-        PrintHierarchicalHelper(subtree->left, true, indent + (isLeft ? "|   " : "    "));
-        PrintHierarchicalHelper(subtree->right, false, indent + (isLeft ? "|   " : "    "));
+		text << subtree->data;
 	}
+	return text.str();
 }
 
 //****************************************************************************
@@ -470,7 +1271,9 @@ void BST<T>::InOrder() const
 }
 
 //****************************************************************************
-//		Helper method to print the contents of the tree in order.
+//		Helper method to print the contents of the tree in order.  The left
+//	spine of each subtree is pushed onto an explicit stack, so the depth of
+//	the tree never reaches the call stack.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
@@ -478,21 +1281,30 @@ void BST<T>::InOrder() const
 template <class T>
 void BST<T>::InOrderHelper(const BNode<T>* subtree) const
 {
-    if (subtree != NULL)
-    {
-        InOrderHelper(subtree->left);
-        
-        if (subtree == cursor)
-        {
-        	cout << "[" << subtree->data << "] ";
-        }
-        else
-        {
+	vector<const BNode<T>*> pending;
+	
+	while (subtree != NULL || !pending.empty())
+	{
+		while (subtree != NULL)
+		{
+			pending.push_back(subtree);
+			subtree = subtree->left;
+		}
+		
+		subtree = pending.back();
+		pending.pop_back();
+		
+		if (subtree == cursor)
+		{
+			cout << "[" << subtree->data << "] ";
+		}
+		else
+		{
 			cout << subtree->data << " ";
 		}
-			
-        InOrderHelper(subtree->right);
-    }
+		
+		subtree = subtree->right;
+	}
 }
 
 //****************************************************************************
@@ -509,7 +1321,8 @@ void BST<T>::PreOrder() const
 }
 
 //****************************************************************************
-//		Helper method to print the contents of the tree in pre order.
+//		Helper method to print the contents of the tree in pre order, using
+//	an explicit stack in place of recursion.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
@@ -517,20 +1330,37 @@ void BST<T>::PreOrder() const
 template <class T>
 void BST<T>::PreOrderHelper(const BNode<T>* subtree) const
 {
-    if (subtree != NULL)
-    {
-    	if (subtree == cursor)
-    	{
-        	cout << "[" << subtree->data << "] ";
-        }
-        else
-        {
+	if (subtree == NULL)
+	{
+		return;
+	}
+	
+	vector<const BNode<T>*> pending;
+	pending.push_back(subtree);
+	
+	while (!pending.empty())
+	{
+		subtree = pending.back();
+		pending.pop_back();
+		
+		if (subtree == cursor)
+		{
+			cout << "[" << subtree->data << "] ";
+		}
+		else
+		{
 			cout << subtree->data << " ";
 		}
-			
-        PreOrderHelper(subtree->left);
-        PreOrderHelper(subtree->right);
-    }
+		
+		if (subtree->right != NULL)
+		{
+			pending.push_back(subtree->right);
+		}
+		if (subtree->left != NULL)
+		{
+			pending.push_back(subtree->left);
+		}
+	}
 }
 
 //****************************************************************************
@@ -547,7 +1377,9 @@ void BST<T>::PostOrder() const
 }
 
 //****************************************************************************
-//		Helper method to print the contents of the tree in post order.
+//		Helper method to print the contents of the tree in post order, using
+//	an explicit stack in place of recursion.  A node is printed once the
+//	last node printed is its right child, or it has no right child.
 //
 //	Parameters:
 //		subtree: pointer to the root of subtree.
@@ -555,27 +1387,45 @@ void BST<T>::PostOrder() const
 template <class T>
 void BST<T>::PostOrderHelper(const BNode<T>* subtree) const
 {
-    if (subtree != NULL)
-    {
-        PostOrderHelper(subtree->left);
-        PostOrderHelper(subtree->right);
-        
-        if (subtree == cursor)
-        {
-        	cout << "[" << subtree->data << "] ";
-        }
-        else
-        {
-			cout << subtree->data << " ";
+	vector<const BNode<T>*> pending;
+	const BNode<T>* lastPrinted = NULL;
+	
+	while (subtree != NULL || !pending.empty())
+	{
+		while (subtree != NULL)
+		{
+			pending.push_back(subtree);
+			subtree = subtree->left;
 		}
-    }
+		
+		const BNode<T>* top = pending.back();
+		
+		if (top->right != NULL && top->right != lastPrinted)
+		{
+			subtree = top->right;
+			continue;
+		}
+		
+		if (top == cursor)
+		{
+			cout << "[" << top->data << "] ";
+		}
+		else
+		{
+			cout << top->data << " ";
+		}
+		
+		lastPrinted = top;
+		pending.pop_back();
+	}
 }
 
 //****************************************************************************
 //		Copy Constructor.
 //****************************************************************************
 template <class T>
-BST<T>::BST(const BST& myBST)
+BST<T>::BST(const BST& myBST): cursor(NULL), nodesVisited(0), 
+	alpha(myBST.alpha), nodeCount(myBST.nodeCount), maxNodeCount(myBST.maxNodeCount)
 {
     if(!myBST.root)
     {
@@ -586,21 +1436,41 @@ BST<T>::BST(const BST& myBST)
 }
 
 //****************************************************************************
-//		Helper method to recursively allocate memory for the new tree.
+//		Helper method to allocate memory for the new tree.  Pairs of source
+//	nodes and the links they are copied into are kept on an explicit stack,
+//	so deep trees are copied without recursion.
 //****************************************************************************
 template<class T>
 void BST<T>::CopyHelper(BNode<T>*& aRoot, BNode<T>* myRoot)
 {
-    if(!myRoot)
+    aRoot = NULL;
+    
+    vector<pair<BNode<T>*, BNode<T>**> > pending;
+    if (myRoot != NULL)
     {
-        aRoot = NULL;
-    }
-    else
+    	pending.push_back(make_pair(myRoot, &aRoot));
+	}
+    
+    while (!pending.empty())
     {
-        aRoot = new BNode<T>(myRoot->data);
-        CopyHelper(aRoot->left, myRoot->left);
-        CopyHelper(aRoot->right, myRoot->right);
-    }
+    	BNode<T>*  source = pending.back().first;
+    	BNode<T>** link   = pending.back().second;
+    	pending.pop_back();
+    	
+    	*link = new BNode<T>(source->data);
+#if BST_ORDER_STATISTICS
+    	(*link)->size = source->size;
+#endif
+    	
+    	if (source->right != NULL)
+    	{
+    		pending.push_back(make_pair(source->right, &(*link)->right));
+		}
+    	if (source->left != NULL)
+    	{
+    		pending.push_back(make_pair(source->left, &(*link)->left));
+		}
+	}
 }
 
 //****************************************************************************
@@ -611,21 +1481,35 @@ BST<T>::~BST()
 {
     DestroyHelper(root);
     root = NULL;
+    nodeCount = 0;
+    maxNodeCount = 0;
 }
 
 //****************************************************************************
-//		Helper method to recursively deallocate the tree.
+//		Helper method to deallocate the tree without recursion or extra 
+//	memory.  While the current node has a left child it is rotated right,
+//	which flattens the tree into a list down the right links, and a node 
+//	with no left child is deleted and its right child taken in its place.
 //****************************************************************************
 template <class T>
 void BST<T>::DestroyHelper(BNode<T>*& Tree)
 {
-   if (Tree != NULL)
+   while (Tree != NULL)
    {
-      DestroyHelper(Tree->left);
-      DestroyHelper(Tree->right);
-      delete Tree;
+      if (Tree->left != NULL)
+      {
+         BNode<T>* temp = Tree->left;
+         Tree->left = temp->right;
+         temp->right = Tree;
+         Tree = temp;
+      }
+      else
+      {
+         BNode<T>* temp = Tree->right;
+         delete Tree;
+         Tree = temp;
+      }
    }
-   Tree = NULL;
 }
 
 //****************************************************************************
@@ -641,6 +1525,11 @@ BST<T>& BST<T>::operator=(const BST<T>& rightTree)
 			DestroyHelper(root);
 		}
 		
+		cursor = NULL;
+		alpha = rightTree.alpha;
+		nodeCount = rightTree.nodeCount;
+		maxNodeCount = rightTree.maxNodeCount;
+		
 		if(rightTree.root == NULL)
 		{
 			root = NULL;
@@ -658,3 +1547,9 @@ template class BST<float>;
 template class BST<double>;
 template class BST<bool>;
 template class BST<char>;
+
+template class BSTIterator<int>;
+template class BSTIterator<float>;
+template class BSTIterator<double>;
+template class BSTIterator<bool>;
+template class BSTIterator<char>;
@@ -11,42 +11,146 @@
 #include <iomanip>
 #include <cstdlib>
 #include <string>
+#include <sstream>
 #include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "FrozenTree.h"
+#include "TreePrinter.h"
 using namespace std;
 
+// Set to 1 to keep the size of each subtree in its node, which makes 
+// Select, Rank and CountInRange O(depth) at the cost of an int per node.
+#ifndef BST_ORDER_STATISTICS
+#define BST_ORDER_STATISTICS 0
+#endif
+
+// Default weight balance for the scapegoat mode.  A subtree may hold at 
+// most this fraction of its parent's nodes on one side.
+#define BST_SCAPEGOAT_ALPHA 0.7
+
 template<class T>
 class BST;
 
+template<class T>
+class BSTIterator;
+
 template <class T>
 class BNode
 {
     T data;
     BNode* left;
     BNode* right;
+#if BST_ORDER_STATISTICS
+    int size = 1;
+#endif
 
     BNode(T newData): data(newData), left(NULL), right(NULL){};
 
     friend class BST<T>;
+    friend class BSTIterator<T>;
+    friend class TreePrinter;
+};
+
+//****************************************************************************
+//		Bidirectional iterator over the keys of a Binary Search Tree in 
+//	order.  The nodes have no parent pointers, so the iterator keeps the
+//	path from the root down to its node.  Moving past either end gives the
+//	end iterator, and stepping back from the end gives the largest key.
+//	Any insertion or deletion invalidates the iterators of that tree.
+//****************************************************************************
+template <class T>
+class BSTIterator
+{
+public:
+	BSTIterator(): root(NULL){};
+	
+	const T& operator*() const { return path.back()->data; }
+	const T* operator->() const { return &path.back()->data; }
+	
+	BSTIterator& operator++();
+	BSTIterator  operator++(int);
+	BSTIterator& operator--();
+	BSTIterator  operator--(int);
+	
+	bool operator==(const BSTIterator& other) const;
+	bool operator!=(const BSTIterator& other) const { return !(*this == other); }
+
+private:
+	BNode<T>*         root;
+	vector<BNode<T>*> path;
+	
+	BSTIterator(BNode<T>* treeRoot): root(treeRoot){};
+	
+	friend class BST<T>;
 };
 
 template <class T>
 class BST
 {
 public:
-    BST(): root(NULL){};                 
+    BST(): root(NULL), cursor(NULL), nodesVisited(0), alpha(0), nodeCount(0),
+    	maxNodeCount(0){};                 
+    BST(const T* keys, int numKeys): root(NULL), cursor(NULL), nodesVisited(0),
+    	alpha(0), nodeCount(0), maxNodeCount(0) { BulkLoad(keys, numKeys); }
 
     void Insert(const T key) { return InsertHelper(key, root); }
 	bool Search(const T key);
-	void Delete(const T key);
+	bool Delete(const T key);
 
-	void PrintTree() const;
-	void PrintHierarchical() const { PrintHierarchicalHelper(root, false, ""); }
+	void PrintTree() const { PrintTree(cout); }
+	void PrintTree(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+				   int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
+	void PrintHierarchical() const { PrintHierarchical(cout); }
+	void PrintHierarchical(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+						   int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
     void InOrder() const;
     void PreOrder() const;
     void PostOrder() const;
 
     void PrintCursor() const;
     void Prune() { return PruneHelper(root); };
+    
+    void BulkLoad(const T* keys, int numKeys);
+    void Rebalance();
+    bool Freeze(FrozenTree<T>& frozen) const;
+    
+    void EnableScapegoat(double newAlpha = BST_SCAPEGOAT_ALPHA);
+    void DisableScapegoat() { alpha = 0; }
+    bool IsScapegoat() const { return alpha > 0; }
+    double GetAlpha() const { return alpha; }
+    int Height() const;
+    
+    typedef BSTIterator<T> iterator;
+    
+    iterator begin() const;
+    iterator end() const { return iterator(root); }
+    iterator LowerBound(const T key) const;
+    iterator UpperBound(const T key) const;
+    
+    template <class Callback>
+    int Range(const T low, const T high, Callback visit) const;
+    
+    template <class Visitor>
+    bool ForEachInOrder(Visitor visit) const;
+    template <class Visitor>
+    bool ForEachPreOrder(Visitor visit) const;
+    template <class Visitor>
+    bool ForEachPostOrder(Visitor visit) const;
+    
+    int Size() const { return nodeCount; }
+    bool Select(int k, T& result) const;
+    int Rank(const T key) const;
+    int CountInRange(const T low, const T high) const;
+    
+    bool Floor(const T key, T& result) const;
+    bool Ceiling(const T key, T& result) const;
+    bool Min(T& result) const;
+    bool Max(T& result) const;
+    
+    long long NodesVisited() const { return nodesVisited; }
+    void ResetNodesVisited() { nodesVisited = 0; }
 
     BST(const BST& myBST);
     ~BST();
@@ -55,22 +159,36 @@ public:
 private:
     BNode<T>* root;
     BNode<T>* cursor;
+    long long nodesVisited;
+    
+    // Scapegoat Counters, alpha is zero when the mode is off.
+    double alpha;
+    int    nodeCount;
+    int    maxNodeCount;
 
     void InsertHelper(const T key, BNode<T>*& subtree);
-	BNode<T>* DeleteHelper(const T key, BNode<T>*& subtree); 
+    void RebuildScapegoat(const T key);
+    int CountNodes(const BNode<T>* subtree) const;
 	
 	BNode<T>* GetMin(BNode<T>* subtree) const;  
-	BNode<T>* GetParent(BNode<T>* subtree) const;
+	
+	// Day-Stout-Warren Balancing Helper Methods.
+	int TreeToVine(BNode<T>*& subtree);
+	void VineToTree(BNode<T>*& subtree, int size);
+	void Compress(BNode<T>*& subtree, int count);
+	
+	// Order Statistic Helper Methods.
+	int SizeOf(const BNode<T>* subtree) const;
+	void UpdateSize(BNode<T>* subtree);
+	void AdjustSizes(const T key, int delta);
+	void RecountSizes();
+	
 	void PruneHelper(BNode<T>* subtree);
 	bool isLeaf(BNode<T>* subtree) const { return (subtree->left == NULL && 
 												   subtree->right == NULL); }
 
-	// Printing in Level Order Helper Methods.
-	int TreeHeight(BNode<T>* subtree) const;
-	void PrintLevel(int height) const;
-	void DispLevel(BNode<T>* subtree, int level, int displace) const;
-
-	void PrintHierarchicalHelper(BNode<T>* subtree, bool isLeft, const std::string& indent = "") const;
+	// Printing Helper Method.
+	string NodeLabel(const BNode<T>* subtree) const;
 	
 	// Printing in Other Order Helper Methods.	
     void PreOrderHelper(const BNode<T>* subtree) const; 
@@ -81,4 +199,180 @@ private:
     void DestroyHelper(BNode<T>*& Tree);
 };
 
+//****************************************************************************
+//		Method to call visit on every key from low to high, inclusive, in 
+//	order.  Subtrees that lie wholly below low are never entered and the
+//	walk stops at the first key above high, so the cost is the depth of
+//	the tree plus the number of keys visited.  It is defined here so the
+//	callback can be any function or function object, and returns the 
+//	number of keys visited.
+//
+//	Parameters:
+//		low: the smallest key to visit.
+//		high: the largest key to visit.
+//		visit: called with each key in the range.
+//****************************************************************************
+template <class T>
+template <class Callback>
+int BST<T>::Range(const T low, const T high, Callback visit) const
+{
+	vector<const BNode<T>*> pending;
+	const BNode<T>* node = root;
+	int count = 0;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			if (node->data < low)
+			{
+				node = node->right;
+			}
+			else
+			{
+				pending.push_back(node);
+				node = node->left;
+			}
+		}
+		
+		if (pending.empty())
+		{
+			break;
+		}
+		
+		node = pending.back();
+		pending.pop_back();
+		
+		if (high < node->data)
+		{
+			break;
+		}
+		
+		visit(node->data);
+		count++;
+		node = node->right;
+	}
+	return count;
+}
+
+//****************************************************************************
+//		Method to call visit on every key in order, without printing 
+//	anything.  It is defined here so the callback can be any function or
+//	function object and can be inlined into the walk.  The walk stops as 
+//	soon as visit returns false, and the method returns false if it was 
+//	stopped early.
+//
+//	Parameters:
+//		visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool BST<T>::ForEachInOrder(Visitor visit) const
+{
+	vector<const BNode<T>*> pending;
+	const BNode<T>* node = root;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		node = pending.back();
+		pending.pop_back();
+		
+		if (!visit(node->data))
+		{
+			return false;
+		}
+		node = node->right;
+	}
+	return true;
+}
+
+//****************************************************************************
+//		Method to call visit on every key in pre order, each node before 
+//	its children, like ForEachInOrder.
+//
+//	Parameters:
+//		visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool BST<T>::ForEachPreOrder(Visitor visit) const
+{
+	vector<const BNode<T>*> pending;
+	
+	if (root != NULL)
+	{
+		pending.push_back(root);
+	}
+	
+	while (!pending.empty())
+	{
+		const BNode<T>* node = pending.back();
+		pending.pop_back();
+		
+		if (!visit(node->data))
+		{
+			return false;
+		}
+		
+		if (node->right != NULL)
+		{
+			pending.push_back(node->right);
+		}
+		if (node->left != NULL)
+		{
+			pending.push_back(node->left);
+		}
+	}
+	return true;
+}
+
+//****************************************************************************
+//		Method to call visit on every key in post order, each node after 
+//	its children, like ForEachInOrder.  A node stays on the stack until 
+//	its right subtree is done, which is known when the last node visited
+//	is its right child.
+//
+//	Parameters:
+//		visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool BST<T>::ForEachPostOrder(Visitor visit) const
+{
+	vector<const BNode<T>*> pending;
+	const BNode<T>* node = root;
+	const BNode<T>* last = NULL;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		const BNode<T>* top = pending.back();
+		if (top->right != NULL && top->right != last)
+		{
+			node = top->right;
+		}
+		else
+		{
+			if (!visit(top->data))
+			{
+				return false;
+			}
+			last = top;
+			pending.pop_back();
+		}
+	}
+	return true;
+}
+
 #endif
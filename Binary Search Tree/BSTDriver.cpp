@@ -29,8 +29,25 @@
 #include "BST.h"
 #include <limits>
 #include <sstream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#define BENCHMARK_SIZE 1000000
+
+// Largest tree the frozen tree benchmark builds, starting from 10^6 keys 
+// and growing tenfold.  10^8 keys needs about 4 GB for the pointer tree 
+// alone, so raise this to 100000000 only on a machine with room for it.
+#define FREEZE_BENCHMARK_MAX 10000000
 
 void printMenu();
+void benchmarkDelete();
+void benchmarkRange();
+void benchmarkBulkLoad();
+void benchmarkScapegoat();
+void benchmarkFreeze();
+void benchmarkForEach();
 
 template <class T> 
 void choose(BST<T>& myTree);
@@ -38,6 +55,9 @@ void choose(BST<T>& myTree);
 template <class T>
 T validateInput(T &value);
 
+template <class T>
+void printKey(const T& key);
+
 int main()
 {
 	BST<int> myTree;
@@ -63,8 +83,11 @@ void printMenu()
 	cout << "| P     | Print Items Pre Order          |" << endl;
 	cout << "| T     | Print Items Post Order         |" << endl;
 	cout << "| H     | Print Items Hierarchical Order |" << endl;
+	cout << "| N     | Print Items In Range           |" << endl;
+	cout << "| #K    | Find K-th Smallest Item        |" << endl;
 	cout << "| @     | Print Cursor Value             |" << endl;
 	cout << "| D     | Delete the Tree                |" << endl;
+	cout << "| B     | Run Benchmarks                 |" << endl;
 	cout << "|_______|________________________________|" << endl << endl;
     cout << "Please choose an operation to perform on the tree." << endl;
     cout << "Enter Q to quit." << endl;	
@@ -211,12 +234,66 @@ void choose(BST<T>& myTree)
 				}
 				break;
 			}
+			case 'n': case 'N':
+			{
+				if (hasInserted)
+				{
+					T low;
+					T high;
+					
+					validateInput(low);
+					validateInput(high);
+					
+					cout << "The contents of the tree from " << low << " to "
+						 << high << " are: [ ";
+					myTree.Range(low, high, printKey<T>);
+					cout << "]" << endl << endl;
+					system("pause");
+				}
+				else
+				{
+					cerr << "\nPlease insert data into the tree." << endl;
+					system("pause");					
+				}
+				break;
+			}
 			case 'd': case 'D':
 			{
 				myTree.~BST();
 				hasInserted = false;
 				break;
 			}
+			case 'b': case 'B':
+			{
+				benchmarkDelete();
+				benchmarkRange();
+				benchmarkBulkLoad();
+				benchmarkScapegoat();
+				benchmarkFreeze();
+				benchmarkForEach();
+				system("pause");
+				break;
+			}
+			case '#':
+			{
+				if (hasInserted)
+				{
+					int k = 0;
+					validateInput(k);
+					
+					if (myTree.Select(k - 1, key))
+						cout << endl << "Item " << k << " in order is " << key << "." << endl;
+					else
+						cerr << endl << "The tree does not have " << k << " items." << endl;
+					system("pause");
+				}
+				else
+				{
+					cerr << "\nPlease insert data into the tree." << endl;
+					system("pause");					
+				}
+				break;
+			}
 			case'@':
 			{
 				if (hasInserted)
@@ -258,6 +335,470 @@ void choose(BST<T>& myTree)
 }
 /* End of choose function */
 
+//****************************************************************************
+//		This function will time the removal of every key from a tree built
+//	from shuffled keys and report how many nodes each deletion touched.
+//	Delete walks the tree once, so its count is the depth of the key plus
+//	the path to the successor.  The previous Delete searched for the key,
+//	walked down again to unlink it and walked to the successor twice, so 
+//	its cost is estimated from the same counts.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkDelete()
+{
+	using namespace std::chrono;
+	
+	vector<int> keys(BENCHMARK_SIZE);
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		keys[i] = i;
+	}
+	
+	mt19937 generator(42);
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	BST<int> tree;
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		tree.Insert(keys[i]);
+	}
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	long long searchVisits = 0;
+	long long deleteVisits = 0;
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		tree.ResetNodesVisited();
+		tree.Search(keys[i]);
+		searchVisits += tree.NodesVisited();
+		
+		tree.ResetNodesVisited();
+		tree.Delete(keys[i]);
+		deleteVisits += tree.NodesVisited();
+	}
+	
+	long long successorVisits = deleteVisits - searchVisits;
+	long long previousVisits  = 2 * searchVisits + 2 * successorVisits;
+	
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		tree.Insert(keys[i]);
+	}
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	steady_clock::time_point start = steady_clock::now();
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		tree.Delete(keys[i]);
+	}
+	steady_clock::time_point stop = steady_clock::now();
+	
+	cout << endl << "     Delete (" << BENCHMARK_SIZE << " keys): " << endl;
+	cout << "                Delete time = " 
+		 << duration_cast<milliseconds>(stop - start).count() << " ms." << endl;
+	cout << "                Nodes visited per delete = " 
+		 << (double)deleteVisits / BENCHMARK_SIZE << endl;
+	cout << "                Previous nodes visited per delete (at least) = "
+		 << (double)previousVisits / BENCHMARK_SIZE << endl << endl;
+}
+/* End of benchmarkDelete function */
+
+//****************************************************************************
+//		This function will time range scans over a tree of shuffled keys.
+//	Range only walks the part of the tree that overlaps the range, while 
+//	the full scan iterates over every key and keeps the ones in range, as a
+//	caller had to before Range existed.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkRange()
+{
+	using namespace std::chrono;
+	
+	const int RANGE_WIDTH   = 1000;
+	const int RANGE_QUERIES = 10000;
+	const int SCAN_QUERIES  = 100;
+	
+	vector<int> keys(BENCHMARK_SIZE);
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		keys[i] = i;
+	}
+	
+	mt19937 generator(42);
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	BST<int> tree;
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		tree.Insert(keys[i]);
+	}
+	
+	uniform_int_distribution<int> distribution(0, BENCHMARK_SIZE - RANGE_WIDTH);
+	long long sum = 0;
+	
+	steady_clock::time_point start = steady_clock::now();
+	for (int i = 0; i < RANGE_QUERIES; i++)
+	{
+		int low = distribution(generator);
+		tree.Range(low, low + RANGE_WIDTH - 1, [&sum](const int& key) { sum += key; });
+	}
+	steady_clock::time_point stop = steady_clock::now();
+	double rangeTime = duration_cast<microseconds>(stop - start).count() / (double)RANGE_QUERIES;
+	
+	start = steady_clock::now();
+	for (int i = 0; i < SCAN_QUERIES; i++)
+	{
+		int low  = distribution(generator);
+		int high = low + RANGE_WIDTH - 1;
+		
+		for (BST<int>::iterator it = tree.begin(); it != tree.end(); ++it)
+		{
+			if (*it >= low && *it <= high)
+			{
+				sum += *it;
+			}
+		}
+	}
+	stop = steady_clock::now();
+	double scanTime = duration_cast<microseconds>(stop - start).count() / (double)SCAN_QUERIES;
+	
+	cout << "     Range (" << RANGE_WIDTH << " of " << BENCHMARK_SIZE << " keys): " << endl;
+	cout << "                Range time per query = " << rangeTime << " us." << endl;
+	cout << "                Full scan time per query = " << scanTime << " us." << endl;
+	cout << "                Checksum = " << sum << endl << endl;
+}
+/* End of benchmarkRange function */
+
+//****************************************************************************
+//		This function will compare building a tree from sorted keys one 
+//	Insert at a time, which gives a tree as deep as it has keys, with 
+//	BulkLoad and with Rebalance on the degenerate tree.  The depth of each
+//	tree is shown as the nodes visited when searching for the largest key.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkBulkLoad()
+{
+	using namespace std::chrono;
+	
+	const int INSERT_SIZE = 20000;
+	
+	vector<int> keys(BENCHMARK_SIZE);
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		keys[i] = i;
+	}
+	
+	BST<int> chain;
+	steady_clock::time_point start = steady_clock::now();
+	for (int i = 0; i < INSERT_SIZE; i++)
+	{
+		chain.Insert(keys[i]);
+	}
+	steady_clock::time_point stop = steady_clock::now();
+	
+	chain.ResetNodesVisited();
+	chain.Search(INSERT_SIZE - 1);
+	long long chainDepth = chain.NodesVisited();
+	
+	cout << "     Sorted Insert (" << INSERT_SIZE << " keys): " << endl;
+	cout << "                Insert time = " 
+		 << duration_cast<milliseconds>(stop - start).count() << " ms." << endl;
+	cout << "                Depth = " << chainDepth << endl;
+	
+	start = steady_clock::now();
+	chain.Rebalance();
+	stop = steady_clock::now();
+	
+	chain.ResetNodesVisited();
+	chain.Search(INSERT_SIZE - 1);
+	
+	cout << "                Rebalance time = " 
+		 << duration_cast<microseconds>(stop - start).count() << " us." << endl;
+	cout << "                Depth after Rebalance = " << chain.NodesVisited() << endl;
+	
+	BST<int> tree;
+	start = steady_clock::now();
+	tree.BulkLoad(&keys[0], BENCHMARK_SIZE);
+	stop = steady_clock::now();
+	
+	tree.ResetNodesVisited();
+	tree.Search(BENCHMARK_SIZE - 1);
+	
+	cout << "     BulkLoad (" << BENCHMARK_SIZE << " keys): " << endl;
+	cout << "                Sorted load time = " 
+		 << duration_cast<milliseconds>(stop - start).count() << " ms." << endl;
+	cout << "                Depth = " << tree.NodesVisited() << endl;
+	
+	mt19937 generator(42);
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	start = steady_clock::now();
+	tree.BulkLoad(&keys[0], BENCHMARK_SIZE);
+	stop = steady_clock::now();
+	
+	cout << "                Shuffled load time = " 
+		 << duration_cast<milliseconds>(stop - start).count() << " ms." << endl << endl;
+}
+/* End of benchmarkBulkLoad function */
+
+//****************************************************************************
+//		This function will time inserting and searching for shuffled keys,
+//	then inserting sorted keys, in the scapegoat mode for a few values of
+//	alpha, and report the height of each tree.  The plain tree is only run
+//	on the shuffled keys, since sorted keys make it a list.  The workload
+//	matches the benchmark in the AVL Tree driver so the two can be compared.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkScapegoat()
+{
+	using namespace std::chrono;
+	
+	const double ALPHAS[]   = { 0.0, 0.55, 0.7, 0.85 };
+	const int    NUM_ALPHAS = sizeof(ALPHAS) / sizeof(ALPHAS[0]);
+	
+	vector<int> keys(BENCHMARK_SIZE);
+	for (int i = 0; i < BENCHMARK_SIZE; i++)
+	{
+		keys[i] = i;
+	}
+	
+	mt19937 generator(42);
+	shuffle(keys.begin(), keys.end(), generator);
+	
+	for (int a = 0; a < NUM_ALPHAS; a++)
+	{
+		BST<int> tree;
+		if (ALPHAS[a] > 0)
+		{
+			tree.EnableScapegoat(ALPHAS[a]);
+		}
+		
+		steady_clock::time_point start = steady_clock::now();
+		for (int i = 0; i < BENCHMARK_SIZE; i++)
+		{
+			tree.Insert(keys[i]);
+		}
+		steady_clock::time_point stop = steady_clock::now();
+		long long insertTime = duration_cast<milliseconds>(stop - start).count();
+		
+		int found = 0;
+		start = steady_clock::now();
+		for (int i = 0; i < BENCHMARK_SIZE; i++)
+		{
+			found += tree.Search(i);
+		}
+		stop = steady_clock::now();
+		long long searchTime = duration_cast<milliseconds>(stop - start).count();
+		
+		if (ALPHAS[a] > 0)
+		{
+			cout << "     Scapegoat, alpha " << ALPHAS[a];
+		}
+		else
+		{
+			cout << "     Plain";
+		}
+		cout << " (" << BENCHMARK_SIZE << " keys): " << endl;
+		cout << "                Shuffled insert time = " << insertTime << " ms." << endl;
+		cout << "                Search time = " << searchTime << " ms." << endl;
+		cout << "                Found = " << found << endl;
+		cout << "                Height = " << tree.Height() << endl;
+		
+		if (ALPHAS[a] > 0)
+		{
+			BST<int> sortedTree;
+			sortedTree.EnableScapegoat(ALPHAS[a]);
+			
+			start = steady_clock::now();
+			for (int i = 0; i < BENCHMARK_SIZE; i++)
+			{
+				sortedTree.Insert(i);
+			}
+			stop = steady_clock::now();
+			
+			cout << "                Sorted insert time = " 
+				 << duration_cast<milliseconds>(stop - start).count() << " ms." << endl;
+			cout << "                Sorted height = " << sortedTree.Height() << endl;
+		}
+		cout << endl;
+	}
+}
+/* End of benchmarkScapegoat function */
+
+//****************************************************************************
+//		This function will time looking up random keys in a balanced tree 
+//	and in a frozen copy of it, one at a time and in batches, for trees of
+//	10^6 keys up to FREEZE_BENCHMARK_MAX keys.  Only the even numbers are 
+//	stored, so about half of the lookups miss.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkFreeze()
+{
+	using namespace std::chrono;
+	
+	mt19937 generator(42);
+	
+	vector<int> queries(BENCHMARK_SIZE);
+	bool* found = new bool[BENCHMARK_SIZE];
+	
+	for (int size = 1000000; size <= FREEZE_BENCHMARK_MAX; size = size * 10)
+	{
+		int* keys = new int[size];
+		for (int i = 0; i < size; i++)
+		{
+			keys[i] = 2 * i;
+		}
+		
+		BST<int> tree(keys, size);
+		delete[] keys;
+		
+		FrozenTree<int> frozen;
+		steady_clock::time_point start = steady_clock::now();
+		tree.Freeze(frozen);
+		steady_clock::time_point stop = steady_clock::now();
+		long long freezeTime = duration_cast<milliseconds>(stop - start).count();
+		
+		uniform_int_distribution<int> pick(0, 2 * size - 1);
+		for (int i = 0; i < BENCHMARK_SIZE; i++)
+		{
+			queries[i] = pick(generator);
+		}
+		
+		int treeHits = 0;
+		start = steady_clock::now();
+		for (int i = 0; i < BENCHMARK_SIZE; i++)
+		{
+			treeHits += tree.Search(queries[i]);
+		}
+		stop = steady_clock::now();
+		long long treeTime = duration_cast<milliseconds>(stop - start).count();
+		
+		int frozenHits = 0;
+		start = steady_clock::now();
+		for (int i = 0; i < BENCHMARK_SIZE; i++)
+		{
+			frozenHits += frozen.Contains(queries[i]);
+		}
+		stop = steady_clock::now();
+		long long frozenTime = duration_cast<milliseconds>(stop - start).count();
+		
+		start = steady_clock::now();
+		int batchHits = frozen.ContainsBatch(&queries[0], found, BENCHMARK_SIZE);
+		stop = steady_clock::now();
+		long long batchTime = duration_cast<milliseconds>(stop - start).count();
+		
+		cout << "     Freeze (" << size << " keys, " << BENCHMARK_SIZE 
+			 << " lookups): " << endl;
+		cout << "                Freeze time = " << freezeTime << " ms." << endl;
+		cout << "                Tree search time = " << treeTime << " ms." << endl;
+		cout << "                Frozen search time = " << frozenTime << " ms." << endl;
+		cout << "                Frozen batch time = " << batchTime << " ms." << endl;
+		cout << "                Found = " << treeHits << " / " << frozenHits 
+			 << " / " << batchHits << endl << endl;
+	}
+	delete[] found;
+}
+/* End of benchmarkFreeze function */
+
+//****************************************************************************
+//		This function will time summing every key of a large tree with the
+//	visitor traversals and with the iterator, and stopping a visitor walk
+//	half way through.
+//
+//	Parameters: N/A.
+//****************************************************************************
+void benchmarkForEach()
+{
+	using namespace std::chrono;
+	
+	const int TREE_SIZE = 10 * BENCHMARK_SIZE;
+	
+	int* keys = new int[TREE_SIZE];
+	for (int i = 0; i < TREE_SIZE; i++)
+	{
+		keys[i] = i;
+	}
+	BST<int> tree(keys, TREE_SIZE);
+	delete[] keys;
+	
+	long long sum = 0;
+	steady_clock::time_point start = steady_clock::now();
+	tree.ForEachInOrder([&](int key)
+	{
+		sum += key;
+		return true;
+	});
+	steady_clock::time_point stop = steady_clock::now();
+	long long inOrderTime = duration_cast<milliseconds>(stop - start).count();
+	
+	long long preSum = 0;
+	start = steady_clock::now();
+	tree.ForEachPreOrder([&](int key)
+	{
+		preSum += key;
+		return true;
+	});
+	stop = steady_clock::now();
+	long long preOrderTime = duration_cast<milliseconds>(stop - start).count();
+	
+	long long postSum = 0;
+	start = steady_clock::now();
+	tree.ForEachPostOrder([&](int key)
+	{
+		postSum += key;
+		return true;
+	});
+	stop = steady_clock::now();
+	long long postOrderTime = duration_cast<milliseconds>(stop - start).count();
+	
+	long long iteratorSum = 0;
+	start = steady_clock::now();
+	for (BST<int>::iterator it = tree.begin(); it != tree.end(); ++it)
+	{
+		iteratorSum += *it;
+	}
+	stop = steady_clock::now();
+	long long iteratorTime = duration_cast<milliseconds>(stop - start).count();
+	
+	int visited = 0;
+	start = steady_clock::now();
+	tree.ForEachInOrder([&](int key)
+	{
+		visited++;
+		return key < TREE_SIZE / 2;
+	});
+	stop = steady_clock::now();
+	long long stopTime = duration_cast<milliseconds>(stop - start).count();
+	
+	cout << "     ForEach (" << TREE_SIZE << " keys): " << endl;
+	cout << "                In order time = " << inOrderTime << " ms." << endl;
+	cout << "                Pre order time = " << preOrderTime << " ms." << endl;
+	cout << "                Post order time = " << postOrderTime << " ms." << endl;
+	cout << "                Iterator time = " << iteratorTime << " ms." << endl;
+	cout << "                Sums = " << sum << " / " << preSum << " / " 
+		 << postSum << " / " << iteratorSum << endl;
+	cout << "                Stopped at half time = " << stopTime << " ms." << endl;
+	cout << "                Visited = " << visited << endl << endl;
+}
+/* End of benchmarkForEach function */
+
+//****************************************************************************
+//		This function will print a single key, for use as a callback.
+//
+//	Parameters:
+//		key: the key to be printed.
+//****************************************************************************
+template <class T>
+void printKey(const T& key)
+{
+	cout << key << " ";
+}
+
 //****************************************************************************
 //		This function will validate the input from the user.  If the user
 //	enters an invalid option for the value, then a message will be displayed
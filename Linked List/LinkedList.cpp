@@ -376,6 +376,7 @@ void LinkedList<T>::Clear()
 	
 	cursor = NULL;
 	head   = NULL;
+	size   = 0;
 }
 
 
@@ -518,37 +519,327 @@ void LinkedList<T>::PrintInLines() const
 //****************************************************************************
 //	NAME: PrintToFile.
 //
-//	DESCRIPTION: Print the contents of the list to a text file.  
+//	DESCRIPTION: Print the contents of the list to a text file.  The file 
+//	             stream is given a large buffer and lines are terminated 
+//	             without flushing, so the list is written in a few large 
+//	             writes rather than one per element.
 //
-//	PARAMETERS: N/A.
+//	PARAMETERS:
+//		fileName: name of the text file to be written.
 //****************************************************************************
 template <class T>
-void LinkedList<T>::PrintToFile() const
+void LinkedList<T>::PrintToFile(const std::string& fileName) const
 {	
-	std::ofstream outfile("listContents.txt");
-	try
+	std::unique_ptr<char[]> ioBuffer(new char[LIST_IO_BUFFER_SIZE]);
+	std::ofstream           outfile;
+	
+	outfile.rdbuf()->pubsetbuf(ioBuffer.get(), LIST_IO_BUFFER_SIZE);
+	outfile.open(fileName.c_str());
+	if (outfile.fail())
+	{
+		std::cerr << "Error: unable to open output file." << std::endl;
+		return;
+	}
+
+	int      ctr  = 1;
+	Node<T>* temp = head;
+	
+	while (temp)
+	{
+		outfile << ctr << ".) " << temp->data << '\n';
+		temp = temp->next;
+		ctr = ctr + 1;
+	}
+	outfile.close();
+}
+
+
+//****************************************************************************
+//	NAME: SaveToFile.
+//
+//	DESCRIPTION: Write a binary snapshot of the list.  The snapshot starts 
+//	             with a fixed header (magic number, version, element size 
+//	             and element count) followed by the payload.  Trivially 
+//	             copyable elements are packed into a contiguous block and 
+//	             written in large chunks; all other types are written one 
+//	             at a time through ListSerializer.  Returns true on success.
+//
+//	PARAMETERS:
+//		fileName: name of the snapshot file to be written.
+//****************************************************************************
+template <class T>
+bool LinkedList<T>::SaveToFile(const std::string& fileName) const
+{
+	std::unique_ptr<char[]> ioBuffer(new char[LIST_IO_BUFFER_SIZE]);
+	std::ofstream           outfile;
+	
+	outfile.rdbuf()->pubsetbuf(ioBuffer.get(), LIST_IO_BUFFER_SIZE);
+	outfile.open(fileName.c_str(), std::ios::out | std::ios::binary);
+	if (outfile.fail())
+	{
+		std::cerr << "Error: unable to open snapshot file." << std::endl;
+		return false;
+	}
+	
+	unsigned int magic    = LIST_SNAPSHOT_MAGIC;
+	unsigned int version  = LIST_SNAPSHOT_VERSION;
+	unsigned int elemSize = std::is_trivially_copyable<T>::value ? 
+	                        sizeof(T) : 0;
+	long long    count    = size;
+	
+	outfile.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+	outfile.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	outfile.write(reinterpret_cast<const char*>(&elemSize), sizeof(elemSize));
+	outfile.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	
+	WritePayload(outfile, typename std::is_trivially_copyable<T>::type());
+	
+	bool success = !outfile.fail();
+	outfile.close();
+	
+	if (!success)
+	{
+		std::cerr << "Error: failed to write snapshot file." << std::endl;
+	}
+	return success;
+}
+
+
+//****************************************************************************
+//	NAME: LoadFromFile.
+//
+//	DESCRIPTION: Replace the contents of the list with a snapshot written by
+//	             SaveToFile.  The header is validated against this element 
+//	             type, and the list is rebuilt in a single pass by appending
+//	             at a tail pointer.  If the file is missing or is not a 
+//	             valid snapshot, an appropriate message will be displayed, 
+//	             the list left unchanged and false returned.  If the 
+//	             snapshot is truncated, the message is displayed and the 
+//	             list left empty.  On success the cursor will point to the 
+//	             head.
+//
+//	PARAMETERS:
+//		fileName: name of the snapshot file to be read.
+//****************************************************************************
+template <class T>
+bool LinkedList<T>::LoadFromFile(const std::string& fileName)
+{
+	std::unique_ptr<char[]> ioBuffer(new char[LIST_IO_BUFFER_SIZE]);
+	std::ifstream           infile;
+	
+	infile.rdbuf()->pubsetbuf(ioBuffer.get(), LIST_IO_BUFFER_SIZE);
+	infile.open(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (infile.fail())
+	{
+		std::cerr << "Error: unable to open snapshot file." << std::endl;
+		return false;
+	}
+	
+	unsigned int magic    = 0;
+	unsigned int version  = 0;
+	unsigned int elemSize = 0;
+	long long    count    = 0;
+	
+	infile.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+	infile.read(reinterpret_cast<char*>(&version), sizeof(version));
+	infile.read(reinterpret_cast<char*>(&elemSize), sizeof(elemSize));
+	infile.read(reinterpret_cast<char*>(&count), sizeof(count));
+	
+	unsigned int expectedSize = std::is_trivially_copyable<T>::value ? 
+	                            sizeof(T) : 0;
+	bool success = false;
+	
+	if (infile.fail() || magic != LIST_SNAPSHOT_MAGIC || 
+	    version != LIST_SNAPSHOT_VERSION || elemSize != expectedSize || 
+		count < 0)
+	{
+		std::cerr << "Error: " << fileName << " is not a valid snapshot";
+		std::cerr << " for this list." << std::endl;
+	}
+	else
+	{
+		Clear();
+		success = ReadPayload(infile, count, 
+		                      typename std::is_trivially_copyable<T>::type());
+		if (!success)
+		{
+			std::cerr << "Error: snapshot " << fileName << " is truncated.";
+			std::cerr << std::endl;
+			Clear();
+		}
+		cursor = head;
+	}
+	
+	infile.close();
+	return success;
+}
+
+
+//****************************************************************************
+//	NAME: WritePayload.
+//
+//	DESCRIPTION: Snapshot helper for trivially copyable elements.  Elements
+//	             are copied into a contiguous block and each full block is 
+//	             written with a single call.
+//
+//	PARAMETERS:
+//		out: the open snapshot stream.
+//****************************************************************************
+template <class T>
+void LinkedList<T>::WritePayload(std::ostream& out, std::true_type) const
+{
+	int      blockSize = (LIST_IO_BUFFER_SIZE / sizeof(T)) > 0 ? 
+	                     (LIST_IO_BUFFER_SIZE / sizeof(T)) : 1;
+	int      used      = 0;
+	Node<T>* temp      = head;
+	
+	std::unique_ptr<T[]> block(new T[blockSize]);
+	
+	while (temp)
 	{
-		if (outfile.fail())
+		block[used] = temp->data;
+		used = used + 1;
+		
+		if (used == blockSize)
 		{
-			std::cerr << "Error: unable to open output file." << std::endl;
+			out.write(reinterpret_cast<const char*>(block.get()), 
+			          used * sizeof(T));
+			used = 0;
 		}
+		temp = temp->next;
 	}
-	catch(...)
+	
+	if (used > 0)
 	{
-		std::string errMsg = "Unexpected error caught while opening file.";
-		std::cerr << errMsg << std::endl;
+		out.write(reinterpret_cast<const char*>(block.get()), 
+		          used * sizeof(T));
 	}
+}
 
-	int      ctr  = 1;
+
+//****************************************************************************
+//	NAME: WritePayload.
+//
+//	DESCRIPTION: Snapshot helper for all other elements.  Each element is 
+//	             handed to ListSerializer in list order.
+//
+//	PARAMETERS:
+//		out: the open snapshot stream.
+//****************************************************************************
+template <class T>
+void LinkedList<T>::WritePayload(std::ostream& out, std::false_type) const
+{
 	Node<T>* temp = head;
 	
 	while (temp)
 	{
-		outfile << ctr << ".) " << temp->data << std::endl;
+		ListSerializer<T>::Write(out, temp->data);
 		temp = temp->next;
-		ctr = ctr + 1;
 	}
-	outfile.close();
+}
+
+
+//****************************************************************************
+//	NAME: ReadPayload.
+//
+//	DESCRIPTION: Snapshot helper for trivially copyable elements.  The 
+//	             payload is read back in large blocks and appended to the 
+//	             list.  Returns false if the stream ends early.
+//
+//	PARAMETERS:
+//		in: the open snapshot stream.
+//		count: number of elements recorded in the header.
+//****************************************************************************
+template <class T>
+bool LinkedList<T>::ReadPayload(std::istream& in, long long count, 
+                                std::true_type)
+{
+	int       blockSize = (LIST_IO_BUFFER_SIZE / sizeof(T)) > 0 ? 
+	                      (LIST_IO_BUFFER_SIZE / sizeof(T)) : 1;
+	Node<T>*  tail      = NULL;
+	long long remaining = count;
+	bool      success   = true;
+	
+	std::unique_ptr<T[]> block(new T[blockSize]);
+	
+	while (remaining > 0 && success)
+	{
+		int toRead = remaining < blockSize ? (int)remaining : blockSize;
+		
+		if (!in.read(reinterpret_cast<char*>(block.get()), 
+		             toRead * sizeof(T)))
+		{
+			success = false;
+		}
+		else
+		{
+			for (int i = 0; i < toRead; i++)
+			{
+				AppendNode(block[i], tail);
+			}
+			remaining = remaining - toRead;
+		}
+	}
+	
+	return success;
+}
+
+
+//****************************************************************************
+//	NAME: ReadPayload.
+//
+//	DESCRIPTION: Snapshot helper for all other elements.  Each element is 
+//	             read through ListSerializer and appended to the list.  
+//	             Returns false if the stream ends early.
+//
+//	PARAMETERS:
+//		in: the open snapshot stream.
+//		count: number of elements recorded in the header.
+//****************************************************************************
+template <class T>
+bool LinkedList<T>::ReadPayload(std::istream& in, long long count, 
+                                std::false_type)
+{
+	Node<T>* tail = NULL;
+	T        key;
+	
+	for (long long i = 0; i < count; i++)
+	{
+		if (!ListSerializer<T>::Read(in, key))
+		{
+			return false;
+		}
+		AppendNode(key, tail);
+	}
+	return true;
+}
+
+
+//****************************************************************************
+//	NAME: AppendNode.
+//
+//	DESCRIPTION: Append a new node after the given tail without walking the
+//	             list, then advance the tail.  Used to bulk build the list.
+//
+//	PARAMETERS:
+//		key: the value to be appended.
+//		tail: the current last node, or NULL when the list is empty.
+//****************************************************************************
+template <class T>
+void LinkedList<T>::AppendNode(const T& key, Node<T>*& tail)
+{
+	Node<T>* temp = new Node<T>(key);
+	
+	if (tail == NULL)
+	{
+		head = temp;
+	}
+	else
+	{
+		tail->next = temp;
+	}
+	tail = temp;
+	size = size + 1;
 }
 
 
@@ -695,10 +986,10 @@ T LinkedList<T>::getTailValue() const
 //****************************************************************************
 template<class T>
 LinkedList<T>::LinkedList(const LinkedList<T>& myList)
+	: head(NULL), cursor(NULL), size(0)
 {
 	if (!myList.head)
 	{
-		head = NULL; 
 		return;
 	}
 		
@@ -713,6 +1004,8 @@ LinkedList<T>::LinkedList(const LinkedList<T>& myList)
 		newtemp=newtemp->next;
 		oldtemp=oldtemp->next;		
 	}
+	cursor = head;
+	size   = myList.size;
 }
 
 
@@ -728,6 +1021,8 @@ LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& myList)
 	}
 		
 	this->~LinkedList();
+	cursor = NULL;
+	size   = 0;
 
 	if (!myList.head)
 	{ 
@@ -746,6 +1041,8 @@ LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& myList)
 		newtemp=newtemp->next;
 		oldtemp=oldtemp->next;		
 	}
+	cursor = head;
+	size   = myList.size;
 	return *this;
 }
 
@@ -9,10 +9,68 @@
 
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <windows.h>
 #include "ApiLogger.h"
 using namespace std;
 
+// Magic number and version stamped into the binary snapshot header.
+#define LIST_SNAPSHOT_MAGIC   0x54534C4C
+#define LIST_SNAPSHOT_VERSION 1
+
+// Size of the stream buffers used when writing or reading a snapshot.
+#define LIST_IO_BUFFER_SIZE   (1 << 20)
+
+//****************************************************************************
+//	Serializer used by SaveToFile and LoadFromFile for element types that 
+//	cannot be copied byte for byte.  Trivially copyable types never go 
+//	through it; the byte copy below only exists so the list still compiles
+//	for them.  A raw copy of a type that owns memory would only save its 
+//	pointers, so any such type must provide its own specialization, like 
+//	the one for string below.
+//****************************************************************************
+template <class T>
+struct ListSerializer
+{
+	static_assert(std::is_trivially_copyable<T>::value, 
+	              "ListSerializer must be specialized for element types "
+	              "that are not trivially copyable.");
+	
+	static void Write(std::ostream& out, const T& value)
+	{
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+	
+	static bool Read(std::istream& in, T& value)
+	{
+		return (bool)in.read(reinterpret_cast<char*>(&value), sizeof(T));
+	}
+};
+
+template <>
+struct ListSerializer<std::string>
+{
+	static void Write(std::ostream& out, const std::string& value)
+	{
+		unsigned int length = (unsigned int)value.size();
+		out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		out.write(value.data(), length);
+	}
+	
+	static bool Read(std::istream& in, std::string& value)
+	{
+		unsigned int length = 0;
+		if (!in.read(reinterpret_cast<char*>(&length), sizeof(length)))
+		{
+			return false;
+		}
+		value.resize(length);
+		return length == 0 || (bool)in.read(&value[0], length);
+	}
+};
+
 template <class T>
 class LinkedList;
 
@@ -50,9 +108,12 @@ public:
 	
 	void Print() const;
 	void PrintInLines() const;
-	void PrintToFile() const;
+	void PrintToFile(const std::string& fileName = "listContents.txt") const;
 	void PrintCursor() const;
 	
+	bool SaveToFile(const std::string& fileName) const;
+	bool LoadFromFile(const std::string& fileName);
+	
 	void moveCursorUp();
 	void moveCursorDown();
 	
@@ -70,6 +131,13 @@ private:
 	Node<T>* cursor;
 	int size;
 	//ApiLogger apiLogger;
+	
+	// Snapshot Helper Methods.
+	void WritePayload(std::ostream& out, std::true_type) const;
+	void WritePayload(std::ostream& out, std::false_type) const;
+	bool ReadPayload(std::istream& in, long long count, std::true_type);
+	bool ReadPayload(std::istream& in, long long count, std::false_type);
+	void AppendNode(const T& key, Node<T>*& tail);
 };
 
 #endif
@@ -167,6 +167,8 @@ void printMenu()
     std::cout << "| *Key   At Front | ~      At Front   | L   in Lines  | ?Key   Search  |" << std::endl;
     std::cout << "| #Key   At End   | `      At End     | B   Sort List | W      Up      |" << std::endl;
     std::cout << "|                 | C      Clear List | G   Size      | S      Down    |" << std::endl;
+    std::cout << "|                 |                   | K   Snapshot  |                |" << std::endl;
+    std::cout << "|                 |                   | O   Load Snap |                |" << std::endl;
     std::cout << "|_________________|___________________|_______________|________________|" << std::endl;
     std::cout << "Please choose an operation to perform on the list." << std::endl;
     std::cout << "Enter E to exit." << std::endl;	
@@ -324,6 +326,35 @@ void choose(LinkedList<T> &myList)
 				}
 				break; 
 			}
+			case 'k': case 'K':
+			{
+				if (hasInserted)
+				{
+					if (myList.SaveToFile("listSnapshot.bin"))
+					{
+						std::cout << "\nSaved the list to listSnapshot.bin.";
+						std::cout << std::endl;
+					}
+				}
+				else
+				{
+					std::cerr << "\nPlease insert data into the list.";
+					std::cerr << std::endl;
+				}
+				WinUtils::pauseScreen();
+				break; 
+			}
+			case 'o': case 'O':
+			{
+				if (myList.LoadFromFile("listSnapshot.bin"))
+				{
+					hasInserted = !myList.isEmpty();
+					std::cout << "\nLoaded " << myList.getSize() << " items";
+					std::cout << " from listSnapshot.bin." << std::endl;
+				}
+				WinUtils::pauseScreen();
+				break; 
+			}
 			case 'l': case 'L':
 			{
 				if (hasInserted)
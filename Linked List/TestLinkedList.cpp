@@ -174,6 +174,9 @@ void TestLinkedList<U>::runTests()
 			std::cout << std::endl;
 			
 			testSearch();
+			std::cout << std::endl;
+			
+			testSnapshot();
 		}
 		else
 		{
@@ -1031,3 +1034,72 @@ bool TestLinkedList<U>::testSearch()
 		
 	testLogger.logEvent("******* Search List Test *******", INFO);
 }
+
+
+//****************************************************************************
+//	NAME: testSnapshot.
+//
+//	DESCRIPTION: This subtest will save the list to a binary snapshot and 
+//				 load it into a second list.  If the second list has the 
+//				 same size as the first and every element matches in 
+//				 order, then the test will pass.  Otherwise, it will fail.
+//****************************************************************************
+template <class U>
+bool TestLinkedList<U>::testSnapshot()
+{
+	testLogger.logEvent("******* Begin Snapshot Test *******", INFO);
+	
+	int subTestStatus = -1;	
+	try
+	{
+		LinkedList<U> loadedList;
+		std::ostringstream oss;
+		
+		oss << "Saving " << testList.getSize() << " items to testSnapshot.bin.";
+		testLogger.logEvent(oss.str(), INFO);
+		
+		bool isSaved  = testList.SaveToFile("testSnapshot.bin");
+		bool isLoaded = isSaved && loadedList.LoadFromFile("testSnapshot.bin");
+		
+		bool isMatch  = isLoaded && loadedList.getSize() == testList.getSize();
+		
+		// Walk copies of both lists from the head, comparing each element.
+		LinkedList<U> savedCopy(testList);
+		LinkedList<U> loadedCopy(loadedList);
+		while (isMatch && !savedCopy.isEmpty())
+		{
+			isMatch = !loadedCopy.isEmpty() && 
+			          loadedCopy.getHeadValue() == savedCopy.getHeadValue();
+			savedCopy.RemoveAtHead();
+			loadedCopy.RemoveAtHead();
+		}
+		isMatch = isMatch && loadedCopy.isEmpty();
+		
+		if (isMatch)
+		{
+			testLogger.logEvent("Loaded list matches the saved list.", INFO);
+			testLogger.printStatusMessage("Snapshot Test Passed.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("Loaded list does NOT match the saved list.", 
+			                    INFO);
+			subTestStatus = FAIL;
+			
+			testLogger.printStatusMessage("Snapshot Test Failed.", FAIL);
+			testLogger.setPassingStatus(FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errorMsg = "Unexpected exception occurred testing the "
+		                       "snapshot functionality.";
+		testLogger.logEvent(errorMsg, FAIL);
+
+		testLogger.printStatusMessage("Snapshot Test Failed.", FAIL);
+		testLogger.setPassingStatus(FAIL);
+	}
+	
+	testLogger.logEvent("******* End Snapshot Test *******", INFO);
+	return subTestStatus;
+}
@@ -34,6 +34,8 @@ public:
 	bool testAtHeadSearch();
 	bool testAtTailSearch();
 	bool testSearch();
+	
+	bool testSnapshot();
 
 private:
 	LinkedList<U> testList;  
@@ -0,0 +1,322 @@
+//***************************************************************************
+//	Implementation File for Templated Blocking Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "BlockingQueue.h"
+
+//***************************************************************************
+//		Constructor.
+//
+//	Parameters:
+//		newCapacity: the most items the queue may hold before producers 
+//					 wait, or 0 for no limit.
+//***************************************************************************
+template<class T>
+BlockingQueue<T>::BlockingQueue(int newCapacity)
+	: capacity(newCapacity > 0 ? newCapacity : 0), closed(false), 
+	  waitingConsumers(0), waitingProducers(0)
+{
+}
+
+//***************************************************************************
+//		Method to add an item at the end of the queue, waiting while the 
+//	queue is full.  Returns false, without adding the item, if the queue is
+//	or becomes closed, or if the item could not be stored.
+//
+//	Parameters:
+//		item: the element to be added.
+//***************************************************************************
+template<class T>
+bool BlockingQueue<T>::Push(T item)
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	
+	while (!closed && IsFull())
+	{
+		waitingProducers = waitingProducers + 1;
+		notFull.wait(lock);
+		waitingProducers = waitingProducers - 1;
+	}
+	
+	if (closed)
+	{
+		return false;
+	}
+	
+	if (!items.Enqueue(item))
+	{
+		return false;
+	}
+	bool wake = (waitingConsumers > 0);
+	lock.unlock();
+	
+	if (wake)
+	{
+		notEmpty.notify_one();
+	}
+	return true;
+}
+
+//***************************************************************************
+//		Method to add numItems items at the end of the queue, in order.  As
+//	many items as fit are added under each lock, and waiting consumers are
+//	notified once per run added rather than once per item.  Waits while the
+//	queue is full.  Returns the number of items added, which is less than 
+//	numItems only if the queue was closed or a run could not be stored.
+//
+//	Parameters:
+//		newItems: the elements to be added.
+//		numItems: the number of elements in newItems.
+//***************************************************************************
+template<class T>
+int BlockingQueue<T>::PushRange(const T* newItems, int numItems)
+{
+	int added = 0;
+	
+	while (added < numItems)
+	{
+		std::unique_lock<std::mutex> lock(queueMutex);
+		
+		while (!closed && IsFull())
+		{
+			waitingProducers = waitingProducers + 1;
+			notFull.wait(lock);
+			waitingProducers = waitingProducers - 1;
+		}
+		
+		if (closed)
+		{
+			break;
+		}
+		
+		int run = numItems - added;
+		if (capacity > 0 && run > capacity - items.Size())
+		{
+			run = capacity - items.Size();
+		}
+		
+		if (!items.EnqueueRange(newItems + added, run))
+		{
+			break;
+		}
+		added = added + run;
+		
+		int waiting = waitingConsumers;
+		lock.unlock();
+		
+		if (waiting > 1 && run > 1)
+		{
+			notEmpty.notify_all();
+		}
+		else if (waiting > 0)
+		{
+			notEmpty.notify_one();
+		}
+	}
+	return added;
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out, waiting
+//	until there is one.  Returns false, leaving out untouched, once the 
+//	queue is closed and empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool BlockingQueue<T>::Pop(T& out)
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	
+	while (!closed && items.IsEmpty())
+	{
+		waitingConsumers = waitingConsumers + 1;
+		notEmpty.wait(lock);
+		waitingConsumers = waitingConsumers - 1;
+	}
+	
+	if (!items.TryDequeue(out))
+	{
+		return false;
+	}
+	
+	WakeProducers(1);
+	return true;
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out, waiting
+//	at most timeout for one to arrive.  Returns false, leaving out 
+//	untouched, if the time ran out or the queue is closed and empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//		timeout: the longest time to wait.
+//***************************************************************************
+template<class T>
+bool BlockingQueue<T>::PopFor(T& out, std::chrono::milliseconds timeout)
+{
+	std::chrono::steady_clock::time_point deadline = 
+	                                  std::chrono::steady_clock::now() + timeout;
+	std::unique_lock<std::mutex> lock(queueMutex);
+	
+	while (!closed && items.IsEmpty())
+	{
+		waitingConsumers = waitingConsumers + 1;
+		std::cv_status result = notEmpty.wait_until(lock, deadline);
+		waitingConsumers = waitingConsumers - 1;
+		
+		if (result == std::cv_status::timeout)
+		{
+			break;
+		}
+	}
+	
+	if (!items.TryDequeue(out))
+	{
+		return false;
+	}
+	
+	WakeProducers(1);
+	return true;
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out without
+//	waiting.  Returns false, leaving out untouched, if the queue is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool BlockingQueue<T>::TryPop(T& out)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	
+	if (!items.TryDequeue(out))
+	{
+		return false;
+	}
+	
+	WakeProducers(1);
+	return true;
+}
+
+//***************************************************************************
+//		Method to move up to maxItems items from the front of the queue into
+//	out, in order, waiting until there is at least one.  Returns the number
+//	of items moved, which is 0 only once the queue is closed and empty.
+//
+//	Parameters:
+//		out: receives the elements; must hold at least maxItems.
+//		maxItems: the largest number of elements to remove.
+//***************************************************************************
+template<class T>
+int BlockingQueue<T>::PopBatch(T* out, int maxItems)
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	
+	while (!closed && items.IsEmpty())
+	{
+		waitingConsumers = waitingConsumers + 1;
+		notEmpty.wait(lock);
+		waitingConsumers = waitingConsumers - 1;
+	}
+	
+	int moved = items.DequeueBatch(out, maxItems);
+	if (moved > 0)
+	{
+		WakeProducers(moved);
+	}
+	return moved;
+}
+
+//***************************************************************************
+//		Method to close the queue and wake every waiting thread.  Later 
+//	pushes are refused, and pops return the items still in the queue 
+//	before they start failing.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void BlockingQueue<T>::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		closed = true;
+	}
+	notEmpty.notify_all();
+	notFull.notify_all();
+}
+
+//***************************************************************************
+//		Method to return true once the queue has been closed.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool BlockingQueue<T>::IsClosed() const
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	return closed;
+}
+
+//***************************************************************************
+//		Method to return the number of items in the queue.  While other 
+//	threads are running the value is only a snapshot.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+int BlockingQueue<T>::Size() const
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	return items.Size();
+}
+
+//***************************************************************************
+//		Method to return true if the queue has a capacity and is at it.  The
+//	caller must hold the lock.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool BlockingQueue<T>::IsFull() const
+{
+	return (capacity > 0 && items.Size() >= capacity);
+}
+
+//***************************************************************************
+//		Method to wake producers waiting for room after numFreed slots were
+//	freed.  One producer is woken per freed slot, and none if no producer 
+//	is waiting.  The caller must hold the lock.
+//
+//	Parameters:
+//		numFreed: the number of items just removed.
+//***************************************************************************
+template<class T>
+void BlockingQueue<T>::WakeProducers(int numFreed)
+{
+	if (waitingProducers == 0)
+	{
+		return;
+	}
+	
+	if (numFreed > 1)
+	{
+		notFull.notify_all();
+	}
+	else
+	{
+		notFull.notify_one();
+	}
+}
+
+template class BlockingQueue<int>;
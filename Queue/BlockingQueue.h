@@ -0,0 +1,63 @@
+//***************************************************************************
+//	Header File for Templated Blocking Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _BLOCKINGQUEUE_H
+#define _BLOCKINGQUEUE_H
+
+#include "Queue.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+using namespace std;
+
+//***************************************************************************
+//	Thread safe queue whose consumers sleep until an item arrives, instead
+//	of polling IsEmpty.  A queue built with a capacity makes producers sleep
+//	while it is full, so a slow consumer pushes back on its producers.  
+//	Close() wakes every waiting thread: from then on pushes are refused, 
+//	and pops drain whatever is left before reporting that the queue is 
+//	closed.
+//
+//	Threads are only notified when someone is waiting.  PushRange notifies 
+//	once for the whole range, and PopBatch lets a woken consumer take up to
+//	a whole batch of items under one lock.
+//***************************************************************************
+template<class T>
+class BlockingQueue
+{
+public:
+	BlockingQueue(int newCapacity = 0);
+	
+	bool Push(T item);
+	int PushRange(const T* newItems, int numItems);
+	bool Pop(T& out);
+	bool PopFor(T& out, std::chrono::milliseconds timeout);
+	bool TryPop(T& out);
+	int PopBatch(T* out, int maxItems);
+	
+	void Close();
+	bool IsClosed() const;
+	int Size() const;
+	int Capacity() const { return capacity; }
+
+	BlockingQueue(const BlockingQueue&) = delete;
+	BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+private:
+	Queue<T>                items;
+	int                     capacity;
+	bool                    closed;
+	int                     waitingConsumers;
+	int                     waitingProducers;
+	mutable std::mutex      queueMutex;
+	std::condition_variable notEmpty;
+	std::condition_variable notFull;
+	
+	bool IsFull() const;
+	void WakeProducers(int numFreed);
+};
+#endif
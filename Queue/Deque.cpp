@@ -0,0 +1,406 @@
+//***************************************************************************
+//	Implementation File for Templated Deque
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "Deque.h"
+
+//***************************************************************************
+//		Constructor.  No map or blocks are allocated until the first push.
+//***************************************************************************
+template<class T>
+Deque<T>::Deque()
+	: map(NULL), mapSize(0), firstBlock(0), numBlocks(0), frontOffset(0), 
+	  count(0)
+{
+}
+
+//***************************************************************************
+//		Method to insert a new item at the front of the deque.  If a bad 
+//	memory allocation exception is detected, then an appropriate message 
+//	will be displayed, and the item will not be inserted.
+//
+//	Parameters:
+//		item: the element to be inserted.
+//***************************************************************************
+template<class T>
+void Deque<T>::PushFront(T item)
+{
+	if (frontOffset == 0)
+	{
+		try
+		{
+			AddBlockAtFront();
+		}
+		catch (bad_alloc & ex)
+		{
+			cerr << "Failed to insert " << item << " into the deque." << endl;
+			return;
+		}
+		frontOffset = blockSize;
+	}
+	
+	frontOffset = frontOffset - 1;
+	map[firstBlock][frontOffset] = std::move(item);
+	count = count + 1;
+}
+
+//***************************************************************************
+//		Method to insert a new item at the back of the deque.  If a bad 
+//	memory allocation exception is detected, then an appropriate message 
+//	will be displayed, and the item will not be inserted.
+//
+//	Parameters:
+//		item: the element to be inserted.
+//***************************************************************************
+template<class T>
+void Deque<T>::PushBack(T item)
+{
+	int position = frontOffset + count;
+	
+	if (position == numBlocks * blockSize)
+	{
+		try
+		{
+			AddBlockAtBack();
+		}
+		catch (bad_alloc & ex)
+		{
+			cerr << "Failed to insert " << item << " into the deque." << endl;
+			return;
+		}
+	}
+	
+	map[firstBlock + position / blockSize][position % blockSize] = 
+	                                                         std::move(item);
+	count = count + 1;
+}
+
+//***************************************************************************
+//		Method to remove the item at the front of the deque.  A block that
+//	is left empty is freed.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void Deque<T>::PopFront()
+{
+	T item;
+	
+	TryPopFront(item);
+}
+
+//***************************************************************************
+//		Method to remove the item at the back of the deque.  A block that is
+//	left empty is freed.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void Deque<T>::PopBack()
+{
+	T item;
+	
+	TryPopBack(item);
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the deque into out and 
+//	remove it.  Returns false, leaving out untouched, if the deque is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the deque.
+//***************************************************************************
+template<class T>
+bool Deque<T>::TryPopFront(T& out)
+{
+	if (count == 0)
+	{
+		return false;
+	}
+	
+	out = std::move(map[firstBlock][frontOffset]);
+	frontOffset = frontOffset + 1;
+	count = count - 1;
+	
+	if (frontOffset == blockSize)
+	{
+		delete[] map[firstBlock];
+		map[firstBlock] = NULL;
+		firstBlock = firstBlock + 1;
+		numBlocks = numBlocks - 1;
+		frontOffset = 0;
+	}
+	return true;
+}
+
+//***************************************************************************
+//		Method to move the item at the back of the deque into out and remove
+//	it.  Returns false, leaving out untouched, if the deque is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the back of the deque.
+//***************************************************************************
+template<class T>
+bool Deque<T>::TryPopBack(T& out)
+{
+	if (count == 0)
+	{
+		return false;
+	}
+	
+	count = count - 1;
+	int position = frontOffset + count;
+	out = std::move(map[firstBlock + position / blockSize]
+	                   [position % blockSize]);
+	
+	if (position == (numBlocks - 1) * blockSize)
+	{
+		int lastBlock = firstBlock + numBlocks - 1;
+		delete[] map[lastBlock];
+		map[lastBlock] = NULL;
+		numBlocks = numBlocks - 1;
+		if (numBlocks == 0)
+		{
+			frontOffset = 0;
+		}
+	}
+	return true;
+}
+
+//***************************************************************************
+//		Method to return a reference to the item at the given index, where
+//	index 0 is the front.  The index is not checked.
+//
+//	Parameters:
+//		index: the position of the element, from 0 to Size() - 1.
+//***************************************************************************
+template<class T>
+T& Deque<T>::operator[](int index)
+{
+	int position = frontOffset + index;
+	return map[firstBlock + position / blockSize][position % blockSize];
+}
+
+//***************************************************************************
+//		Method to return a reference to the item at the given index, where
+//	index 0 is the front.  The index is not checked.
+//
+//	Parameters:
+//		index: the position of the element, from 0 to Size() - 1.
+//***************************************************************************
+template<class T>
+const T& Deque<T>::operator[](int index) const
+{
+	int position = frontOffset + index;
+	return map[firstBlock + position / blockSize][position % blockSize];
+}
+
+//***************************************************************************
+//		Method to remove every item and free every block.  The map is kept.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void Deque<T>::Clear()
+{
+	for (int i = 0; i < numBlocks; i++)
+	{
+		delete[] map[firstBlock + i];
+		map[firstBlock + i] = NULL;
+	}
+	
+	firstBlock = mapSize / 2;
+	numBlocks = 0;
+	frontOffset = 0;
+	count = 0;
+}
+
+//***************************************************************************
+//		Method that will print the contents of the deque from front to back.
+//	The front element will be enclosed in square brackets.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void Deque<T>::Print() const
+{
+	if (count == 0)
+	{
+		return;
+	}
+	
+	cout << "-------------" << endl;
+	cout << "[" << (*this)[0] << "]," << endl;
+	
+	for (int i = 1; i < count; i++)
+	{
+		cout << (*this)[i] << "," << endl;
+	}
+	cout << "-------------" << endl;
+}
+
+//***************************************************************************
+//		Method to allocate an empty block in front of the first block.  May
+//	throw bad_alloc, in which case the deque is unchanged.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void Deque<T>::AddBlockAtFront()
+{
+	if (firstBlock == 0)
+	{
+		MakeRoomInMap(true);
+	}
+	
+	map[firstBlock - 1] = new T[blockSize];
+	firstBlock = firstBlock - 1;
+	numBlocks = numBlocks + 1;
+}
+
+//***************************************************************************
+//		Method to allocate an empty block after the last block.  May throw
+//	bad_alloc, in which case the deque is unchanged.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void Deque<T>::AddBlockAtBack()
+{
+	if (firstBlock + numBlocks == mapSize)
+	{
+		MakeRoomInMap(false);
+	}
+	
+	map[firstBlock + numBlocks] = new T[blockSize];
+	numBlocks = numBlocks + 1;
+}
+
+//***************************************************************************
+//		Method to make room in the map for one more block at the given end.
+//	If the map is less than half full its block pointers are recentred; 
+//	otherwise a map twice the size is allocated and the pointers moved 
+//	into its middle.  Only pointers move, never the elements.  May throw 
+//	bad_alloc, in which case the deque is unchanged.
+//
+//	Parameters:
+//		atFront: true if the room is needed in front of the first block.
+//***************************************************************************
+template<class T>
+void Deque<T>::MakeRoomInMap(bool atFront)
+{
+	int newSize = mapSize;
+	
+	if (numBlocks + 1 > mapSize / 2)
+	{
+		newSize = (mapSize == 0) ? DEQUE_MIN_MAP_SIZE : mapSize * 2;
+	}
+	
+	int newFirst = (newSize - numBlocks) / 2;
+	if (atFront && newFirst == 0)
+	{
+		newFirst = 1;
+	}
+	
+	if (newSize == mapSize)
+	{
+		if (newFirst < firstBlock)
+		{
+			for (int i = 0; i < numBlocks; i++)
+			{
+				map[newFirst + i] = map[firstBlock + i];
+			}
+		}
+		else
+		{
+			for (int i = numBlocks - 1; i >= 0; i--)
+			{
+				map[newFirst + i] = map[firstBlock + i];
+			}
+		}
+		
+		for (int i = 0; i < mapSize; i++)
+		{
+			if (i < newFirst || i >= newFirst + numBlocks)
+			{
+				map[i] = NULL;
+			}
+		}
+	}
+	else
+	{
+		T** newMap = new T*[newSize];
+		for (int i = 0; i < newSize; i++)
+		{
+			newMap[i] = NULL;
+		}
+		for (int i = 0; i < numBlocks; i++)
+		{
+			newMap[newFirst + i] = map[firstBlock + i];
+		}
+		delete[] map;
+		map = newMap;
+		mapSize = newSize;
+	}
+	firstBlock = newFirst;
+}
+
+//***************************************************************************
+//		Copy Constructor.
+//***************************************************************************
+template<class T>
+Deque<T>::Deque(const Deque<T>& myDeque)
+	: map(NULL), mapSize(0), firstBlock(0), numBlocks(0), frontOffset(0), 
+	  count(0)
+{
+	for (int i = 0; i < myDeque.count; i++)
+	{
+		PushBack(myDeque[i]);
+	}
+}
+
+//***************************************************************************
+//		Assignment Operator.
+//***************************************************************************
+template<class T>
+Deque<T>& Deque<T>::operator=(const Deque<T>& myDeque)
+{
+	if (this == &myDeque)
+	{
+		return *this;
+	}
+	
+	Clear();
+	for (int i = 0; i < myDeque.count; i++)
+	{
+		PushBack(myDeque[i]);
+	}
+	return *this;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T>
+Deque<T>::~Deque()
+{
+	Clear();
+	delete[] map;
+	map = NULL;
+	mapSize = 0;
+}
+
+template class Deque<int>;
+template class Deque<double>;
+template class Deque<float>;
+template class Deque<char>;
+template class Deque<bool>;
+template class Deque<string>;
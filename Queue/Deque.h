@@ -0,0 +1,75 @@
+//***************************************************************************
+//	Header File for Templated Deque
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _DEQUE_H
+#define _DEQUE_H
+
+#include <iostream>
+#include <string>
+#include <utility>
+using namespace std;
+
+// Size in bytes of each block of elements; blocks hold at least 16 items.
+#define DEQUE_BLOCK_BYTES 4096
+
+// Number of block pointers in the first map allocated.
+#define DEQUE_MIN_MAP_SIZE 8
+
+//***************************************************************************
+//	Double ended queue stored as fixed size blocks of elements, reached 
+//	through a map of block pointers.  Pushing or popping at either end 
+//	touches only the end block, and allocates or frees a whole block only 
+//	when one fills or empties, so both ends are O(1).  Element i lives at a
+//	fixed block and offset, so indexing is O(1) as well.
+//
+//	Growing the deque only ever moves block pointers in the map, never the
+//	elements themselves, so references to elements stay valid while items
+//	are pushed or popped at the ends (except for the popped items).
+//***************************************************************************
+template<class T>
+class Deque
+{
+public:
+	Deque();
+	
+	void PushFront(T item);
+	void PushBack(T item);
+	void PopFront();
+	void PopBack();
+	bool TryPopFront(T& out);
+	bool TryPopBack(T& out);
+	
+	T& Front() { return (*this)[0]; }
+	T& Back() { return (*this)[count - 1]; }
+	T& operator[](int index);
+	const T& operator[](int index) const;
+	
+	bool IsEmpty() const { return (count == 0); }
+	int Size() const { return count; }
+	void Clear();
+	
+	void Print() const;
+
+	Deque(const Deque& myDeque);
+	Deque& operator=(const Deque& myDeque);
+	~Deque();
+
+private:
+	T**  map;
+	int  mapSize;
+	int  firstBlock;
+	int  numBlocks;
+	int  frontOffset;
+	int  count;
+	
+	static const int blockSize = (sizeof(T) * 16 > DEQUE_BLOCK_BYTES) ? 16 :
+	                             (int)(DEQUE_BLOCK_BYTES / sizeof(T));
+	
+	void AddBlockAtFront();
+	void AddBlockAtBack();
+	void MakeRoomInMap(bool atFront);
+};
+#endif
@@ -0,0 +1,228 @@
+//***************************************************************************
+//	Implementation File for Fork Join Pool
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "ForkJoinPool.h"
+
+thread_local ForkJoinPool* ForkJoinPool::currentPool   = NULL;
+thread_local int           ForkJoinPool::currentWorker = -1;
+
+//***************************************************************************
+//		Constructor.  Starts numThreads - 1 background workers; the thread
+//	that calls Invoke is the last worker.  The workers sleep until Invoke is
+//	called.
+//
+//	Parameters:
+//		numThreads: the number of workers, or 0 for one per hardware thread.
+//***************************************************************************
+ForkJoinPool::ForkJoinPool(int numThreads)
+	: numWorkers(numThreads), deques(NULL), active(false), shutdown(false)
+{
+	if (numWorkers <= 0)
+	{
+		numWorkers = (int)std::thread::hardware_concurrency();
+		if (numWorkers <= 0)
+		{
+			numWorkers = 1;
+		}
+	}
+	
+	deques = new WorkStealingDeque<ForkJoinTask*>[numWorkers];
+	for (int i = 1; i < numWorkers; i++)
+	{
+		threads.push_back(std::thread(&ForkJoinPool::WorkerLoop, this, i));
+	}
+}
+
+//***************************************************************************
+//		Method to run the root task on the calling thread, with the rest of
+//	the pool stealing the tasks it spawns, and wait for it to finish.
+//
+//	Parameters:
+//		root: the task to be run.
+//***************************************************************************
+void ForkJoinPool::Invoke(ForkJoinTask* root)
+{
+	std::lock_guard<std::mutex> invokeLock(invokeMutex);
+	
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		active.store(true, std::memory_order_release);
+	}
+	wakeWorkers.notify_all();
+	
+	ForkJoinPool* savedPool   = currentPool;
+	int           savedWorker = currentWorker;
+	currentPool = this;
+	currentWorker = 0;
+	
+	Execute(root);
+	
+	currentPool = savedPool;
+	currentWorker = savedWorker;
+	
+	std::lock_guard<std::mutex> lock(poolMutex);
+	active.store(false, std::memory_order_release);
+}
+
+//***************************************************************************
+//		Method to make a task available to run in parallel with the caller.
+//	On a worker of this pool the task is pushed onto that worker's deque;
+//	anywhere else it is run in place.
+//
+//	Parameters:
+//		task: the task to be spawned.
+//***************************************************************************
+void ForkJoinPool::Spawn(ForkJoinTask* task)
+{
+	if (currentPool != this)
+	{
+		Execute(task);
+		return;
+	}
+	deques[currentWorker].Push(task);
+}
+
+//***************************************************************************
+//		Method to wait for a spawned task to finish.  While it waits, the 
+//	worker runs tasks from its own deque or steals them from others; often
+//	the first task it takes is the one it is waiting for.
+//
+//	Parameters:
+//		task: the task to wait for.
+//***************************************************************************
+void ForkJoinPool::Sync(ForkJoinTask* task)
+{
+	if (currentPool != this)
+	{
+		if (!task->IsDone())
+		{
+			Execute(task);
+		}
+		return;
+	}
+	
+	while (!task->IsDone())
+	{
+		if (!RunOneTask(currentWorker))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+//***************************************************************************
+//		Method run by each background worker.  While an Invoke is in 
+//	progress the worker steals and runs tasks; otherwise it sleeps.
+//
+//	Parameters:
+//		worker: the index of this worker's deque.
+//***************************************************************************
+void ForkJoinPool::WorkerLoop(int worker)
+{
+	currentPool = this;
+	currentWorker = worker;
+	
+	while (true)
+	{
+		if (!active.load(std::memory_order_acquire))
+		{
+			std::unique_lock<std::mutex> lock(poolMutex);
+			while (!active.load(std::memory_order_relaxed) && !shutdown)
+			{
+				wakeWorkers.wait(lock);
+			}
+			if (shutdown)
+			{
+				return;
+			}
+		}
+		
+		if (!RunOneTask(worker))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+//***************************************************************************
+//		Method to run one task, taking it from the worker's own deque if it
+//	has one and stealing from a random victim otherwise.  Returns false if
+//	no task was found.
+//
+//	Parameters:
+//		worker: the index of the calling worker's deque.
+//***************************************************************************
+bool ForkJoinPool::RunOneTask(int worker)
+{
+	ForkJoinTask* task = NULL;
+	
+	if (!deques[worker].Take(task))
+	{
+		if (numWorkers == 1 || !deques[PickVictim(worker)].Steal(task))
+		{
+			return false;
+		}
+	}
+	
+	Execute(task);
+	return true;
+}
+
+//***************************************************************************
+//		Method to run a task and mark it done.
+//
+//	Parameters:
+//		task: the task to be run.
+//***************************************************************************
+void ForkJoinPool::Execute(ForkJoinTask* task)
+{
+	task->work();
+	task->done.store(true, std::memory_order_release);
+}
+
+//***************************************************************************
+//		Method to choose a random worker other than the caller to steal 
+//	from.
+//
+//	Parameters:
+//		worker: the index of the calling worker.
+//***************************************************************************
+int ForkJoinPool::PickVictim(int worker) const
+{
+	static thread_local unsigned int seed = 0;
+	
+	if (seed == 0)
+	{
+		seed = (unsigned int)(unsigned long long)&seed | 1u;
+	}
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	
+	int victim = (int)(seed % (unsigned int)(numWorkers - 1));
+	return (victim >= worker) ? victim + 1 : victim;
+}
+
+//***************************************************************************
+//		Destructor.  Wakes and joins the background workers.
+//***************************************************************************
+ForkJoinPool::~ForkJoinPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		shutdown = true;
+	}
+	wakeWorkers.notify_all();
+	
+	for (size_t i = 0; i < threads.size(); i++)
+	{
+		threads[i].join();
+	}
+	delete[] deques;
+	deques = NULL;
+}
+
+template class WorkStealingDeque<ForkJoinTask*>;
@@ -0,0 +1,87 @@
+//***************************************************************************
+//	Header File for Fork Join Pool
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _FORKJOINPOOL_H
+#define _FORKJOINPOOL_H
+
+#include "WorkStealingDeque.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+//***************************************************************************
+//	A piece of work for the fork join pool.  The caller owns the task, 
+//	usually as a local variable, and must keep it alive until Sync returns.
+//***************************************************************************
+class ForkJoinTask
+{
+public:
+	ForkJoinTask(std::function<void()> newWork)
+		: work(newWork), done(false){}
+	
+	bool IsDone() const { return done.load(std::memory_order_acquire); }
+
+private:
+	std::function<void()> work;
+	std::atomic<bool>     done;
+	
+	ForkJoinTask(const ForkJoinTask&) = delete;
+	ForkJoinTask& operator=(const ForkJoinTask&) = delete;
+
+	friend class ForkJoinPool;
+};
+
+//***************************************************************************
+//	Fork join thread pool built on work stealing deques.  Every worker has
+//	its own deque.  Spawn pushes a task onto the calling worker's deque, 
+//	where it stays if nobody is idle, so a spawn costs a push and a take.
+//	Idle workers steal the oldest task from a random victim, which is the
+//	largest piece of the recursion still waiting.  Sync runs other tasks 
+//	while it waits, so a waiting worker never sits idle.
+//
+//	Invoke runs a root task with the calling thread as worker 0, and 
+//	returns once the root task has finished.  Only one Invoke may run at a
+//	time.  Spawn and Sync called from a thread outside the pool simply run
+//	the task in place.
+//***************************************************************************
+class ForkJoinPool
+{
+public:
+	ForkJoinPool(int numThreads = 0);
+	
+	void Invoke(ForkJoinTask* root);
+	void Spawn(ForkJoinTask* task);
+	void Sync(ForkJoinTask* task);
+	
+	int ThreadCount() const { return numWorkers; }
+
+	ForkJoinPool(const ForkJoinPool&) = delete;
+	ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+	~ForkJoinPool();
+
+private:
+	int                                   numWorkers;
+	WorkStealingDeque<ForkJoinTask*>*     deques;
+	std::vector<std::thread>              threads;
+	std::mutex                            poolMutex;
+	std::mutex                            invokeMutex;
+	std::condition_variable               wakeWorkers;
+	std::atomic<bool>                     active;
+	bool                                  shutdown;
+	
+	static thread_local ForkJoinPool* currentPool;
+	static thread_local int           currentWorker;
+	
+	void WorkerLoop(int worker);
+	bool RunOneTask(int worker);
+	void Execute(ForkJoinTask* task);
+	int PickVictim(int worker) const;
+};
+#endif
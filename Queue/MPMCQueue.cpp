@@ -0,0 +1,335 @@
+//***************************************************************************
+//	Implementation File for Templated Multi Producer Multi Consumer Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "MPMCQueue.h"
+
+//***************************************************************************
+//		Constructor.  The capacity is rounded up to a power of two, with a
+//	minimum of two cells, and cell i starts with sequence i so that every 
+//	cell is free for the first lap of producers.  The capacity is capped 
+//	at MPMC_MAX_CAPACITY.
+//
+//	Parameters:
+//		newCapacity: the number of items the queue should be able to hold.
+//***************************************************************************
+template<class T>
+MPMCQueue<T>::MPMCQueue(int newCapacity)
+	: cells(NULL), capacity(2), mask(0), enqueuePos(0), dequeuePos(0)
+{
+	while ((int)capacity < newCapacity && capacity < MPMC_MAX_CAPACITY)
+	{
+		capacity = capacity << 1;
+	}
+	mask = capacity - 1;
+	
+	cells = new MPMCCell<T>[capacity];
+	for (unsigned int i = 0; i < capacity; i++)
+	{
+		cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+//***************************************************************************
+//		Method to add an item at the end of the queue.  Returns false, 
+//	leaving the queue unchanged, if the queue is full.
+//
+//	Parameters:
+//		item: the element to be added.
+//***************************************************************************
+template<class T>
+bool MPMCQueue<T>::TryEnqueue(T item)
+{
+	unsigned int pos = enqueuePos.load(std::memory_order_relaxed);
+	
+	while (true)
+	{
+		MPMCCell<T>& cell = cells[pos & mask];
+		unsigned int seq  = cell.sequence.load(std::memory_order_acquire);
+		int          diff = (int)(seq - pos);
+		
+		if (diff == 0)
+		{
+			if (enqueuePos.compare_exchange_weak(pos, pos + 1, 
+			                                     std::memory_order_relaxed))
+			{
+				cell.data = std::move(item);
+				cell.sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+		{
+			// The cell still holds an item from the previous lap.
+			return false;
+		}
+		else
+		{
+			// Another producer claimed this position first.
+			pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out and 
+//	remove it.  Returns false, leaving out untouched, if the queue is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool MPMCQueue<T>::TryDequeue(T& out)
+{
+	unsigned int pos = dequeuePos.load(std::memory_order_relaxed);
+	
+	while (true)
+	{
+		MPMCCell<T>& cell = cells[pos & mask];
+		unsigned int seq  = cell.sequence.load(std::memory_order_acquire);
+		int          diff = (int)(seq - (pos + 1));
+		
+		if (diff == 0)
+		{
+			if (dequeuePos.compare_exchange_weak(pos, pos + 1, 
+			                                     std::memory_order_relaxed))
+			{
+				out = std::move(cell.data);
+				cell.sequence.store(pos + capacity, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+		{
+			// The cell has not been filled yet.
+			return false;
+		}
+		else
+		{
+			// Another consumer claimed this position first.
+			pos = dequeuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+//***************************************************************************
+//		Method to add as many of the items as there are free cells for, in
+//	order.  The run of cells is claimed with a single compare-exchange, so
+//	the items stay together in the queue.  Returns the number added.
+//
+//	Parameters:
+//		items: the elements to be added.
+//		numItems: the number of elements in items.
+//***************************************************************************
+template<class T>
+int MPMCQueue<T>::TryEnqueueBatch(const T* items, int numItems)
+{
+	unsigned int pos = enqueuePos.load(std::memory_order_relaxed);
+	int          run = 0;
+	
+	if (numItems <= 0)
+	{
+		return 0;
+	}
+	
+	while (true)
+	{
+		// Count how many cells starting at pos are free on this lap.
+		run = 0;
+		while (run < numItems)
+		{
+			unsigned int seq = 
+			     cells[(pos + run) & mask].sequence.load(std::memory_order_acquire);
+			if (seq != pos + run)
+			{
+				break;
+			}
+			run = run + 1;
+		}
+		
+		if (run == 0)
+		{
+			unsigned int seq = cells[pos & mask].sequence.load(
+			                                      std::memory_order_acquire);
+			if ((int)(seq - pos) < 0)
+			{
+				return 0;
+			}
+			pos = enqueuePos.load(std::memory_order_relaxed);
+			continue;
+		}
+		
+		if (enqueuePos.compare_exchange_weak(pos, pos + run, 
+		                                     std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+	
+	for (int i = 0; i < run; i++)
+	{
+		MPMCCell<T>& cell = cells[(pos + i) & mask];
+		cell.data = items[i];
+		cell.sequence.store(pos + i + 1, std::memory_order_release);
+	}
+	return run;
+}
+
+//***************************************************************************
+//		Method to move up to maxItems items from the front of the queue into
+//	out, in order.  The run of cells is claimed with a single 
+//	compare-exchange.  Returns the number of items moved.
+//
+//	Parameters:
+//		out: receives the elements; must hold at least maxItems.
+//		maxItems: the largest number of elements to remove.
+//***************************************************************************
+template<class T>
+int MPMCQueue<T>::TryDequeueBatch(T* out, int maxItems)
+{
+	unsigned int pos = dequeuePos.load(std::memory_order_relaxed);
+	int          run = 0;
+	
+	if (maxItems <= 0)
+	{
+		return 0;
+	}
+	
+	while (true)
+	{
+		// Count how many cells starting at pos hold items on this lap.
+		run = 0;
+		while (run < maxItems)
+		{
+			unsigned int seq = 
+			     cells[(pos + run) & mask].sequence.load(std::memory_order_acquire);
+			if (seq != pos + run + 1)
+			{
+				break;
+			}
+			run = run + 1;
+		}
+		
+		if (run == 0)
+		{
+			unsigned int seq = cells[pos & mask].sequence.load(
+			                                      std::memory_order_acquire);
+			if ((int)(seq - (pos + 1)) < 0)
+			{
+				return 0;
+			}
+			pos = dequeuePos.load(std::memory_order_relaxed);
+			continue;
+		}
+		
+		if (dequeuePos.compare_exchange_weak(pos, pos + run, 
+		                                     std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+	
+	for (int i = 0; i < run; i++)
+	{
+		MPMCCell<T>& cell = cells[(pos + i) & mask];
+		out[i] = std::move(cell.data);
+		cell.sequence.store(pos + i + capacity, std::memory_order_release);
+	}
+	return run;
+}
+
+//***************************************************************************
+//		Method to add an item at the end of the queue, waiting for a free 
+//	cell if the queue is full.
+//
+//	Parameters:
+//		item: the element to be added.
+//***************************************************************************
+template<class T>
+void MPMCQueue<T>::Enqueue(T item)
+{
+	int attempts = 0;
+	
+	while (!TryEnqueue(item))
+	{
+		Backoff(attempts);
+	}
+}
+
+//***************************************************************************
+//		Method to remove and return the item at the front of the queue, 
+//	waiting for an item if the queue is empty.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+T MPMCQueue<T>::Dequeue()
+{
+	T   item     = T();
+	int attempts = 0;
+	
+	while (!TryDequeue(item))
+	{
+		Backoff(attempts);
+	}
+	return item;
+}
+
+//***************************************************************************
+//		Method to return the number of items in the queue.  While other 
+//	threads are running the value is only a snapshot.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+int MPMCQueue<T>::Size() const
+{
+	unsigned int head = dequeuePos.load(std::memory_order_acquire);
+	unsigned int tail = enqueuePos.load(std::memory_order_acquire);
+	int          size = (int)(tail - head);
+	
+	return (size < 0) ? 0 : size;
+}
+
+//***************************************************************************
+//		Method to wait between attempts of a blocking call.  The first 
+//	MPMC_SPIN_LIMIT attempts retry at once, and later ones give up the rest
+//	of the time slice so a waiting thread does not starve the thread it is
+//	waiting on.
+//
+//	Parameters:
+//		attempts: the number of attempts made so far; updated.
+//***************************************************************************
+template<class T>
+void MPMCQueue<T>::Backoff(int& attempts)
+{
+	if (attempts < MPMC_SPIN_LIMIT)
+	{
+		attempts = attempts + 1;
+	}
+	else
+	{
+		std::this_thread::yield();
+	}
+}
+
+//***************************************************************************
+//		Destructor.  Must only run once every thread is done with the queue.
+//***************************************************************************
+template<class T>
+MPMCQueue<T>::~MPMCQueue()
+{
+	delete[] cells;
+	cells = NULL;
+}
+
+template class MPMCQueue<int>;
+template class MPMCQueue<double>;
+template class MPMCQueue<float>;
+template class MPMCQueue<char>;
+template class MPMCQueue<bool>;
+template class MPMCQueue<string>;
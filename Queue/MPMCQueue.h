@@ -0,0 +1,90 @@
+//***************************************************************************
+//	Header File for Templated Multi Producer Multi Consumer Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _MPMCQUEUE_H
+#define _MPMCQUEUE_H
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <utility>
+using namespace std;
+
+// Size of a cache line.  The enqueue and dequeue positions are kept on 
+// separate lines so producers and consumers do not contend on one line.
+#define MPMC_CACHE_LINE  64
+
+// Number of times a blocking call retries before it starts yielding.
+#define MPMC_SPIN_LIMIT  64
+
+// Largest capacity a queue can have, the biggest power of two an int can
+// hold.  Larger requests are capped to it.
+#define MPMC_MAX_CAPACITY (1 << 30)
+
+template<class T>
+class MPMCQueue;
+
+template<class T>
+class MPMCCell
+{
+	std::atomic<unsigned int> sequence;
+	T data;
+	
+	MPMCCell(): sequence(0), data(){}
+
+	friend class MPMCQueue<T>;
+};
+
+//***************************************************************************
+//	Lock-free bounded ring queue that may be shared by any number of 
+//	producer and consumer threads.
+//
+//	Every cell carries a sequence number that says whose turn it is.  A 
+//	cell at position pos is free for a producer when its sequence equals 
+//	pos, and holds an item for a consumer when its sequence equals pos + 1.
+//	A thread claims a position by advancing the shared enqueue or dequeue
+//	position with one compare-exchange, works on the cell privately, and 
+//	then hands it on by storing the next sequence number.  Producers only 
+//	contend with producers and consumers with consumers.
+//
+//	The batch calls claim a whole run of ready cells with one 
+//	compare-exchange.  Enqueue and Dequeue wrap the Try calls, spinning 
+//	briefly and then yielding until they succeed.
+//***************************************************************************
+template<class T>
+class MPMCQueue
+{
+public:
+	MPMCQueue(int newCapacity = 1024);
+	
+	bool TryEnqueue(T item);
+	bool TryDequeue(T& out);
+	int TryEnqueueBatch(const T* items, int numItems);
+	int TryDequeueBatch(T* out, int maxItems);
+	
+	void Enqueue(T item);
+	T Dequeue();
+	
+	bool IsEmpty() const { return (Size() == 0); }
+	int Size() const;
+	int Capacity() const { return (int)capacity; }
+
+	MPMCQueue(const MPMCQueue&) = delete;
+	MPMCQueue& operator=(const MPMCQueue&) = delete;
+	~MPMCQueue();
+
+private:
+	MPMCCell<T>* cells;
+	unsigned int capacity;
+	unsigned int mask;
+	
+	alignas(MPMC_CACHE_LINE) std::atomic<unsigned int> enqueuePos;
+	alignas(MPMC_CACHE_LINE) std::atomic<unsigned int> dequeuePos;
+	
+	static void Backoff(int& attempts);
+};
+#endif
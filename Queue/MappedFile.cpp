@@ -0,0 +1,197 @@
+//***************************************************************************
+//	Implementation File for Memory Mapped File
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "MappedFile.h"
+#include <cstdio>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//***************************************************************************
+//		Constructor.
+//***************************************************************************
+MappedFile::MappedFile()
+#ifdef _WIN32
+	: file(INVALID_HANDLE_VALUE), mapping(NULL), data(NULL), size(0)
+#else
+	: fd(-1), data(NULL), size(0)
+#endif
+{
+}
+
+//***************************************************************************
+//		Method to open the file at path, creating it if needed, resize it to
+//	newSize bytes, and map the whole file.  Returns false, with a message,
+//	if any step fails.  A file that is already open is closed first.  The
+//	same file may be open in several MappedFiles at once, and renamed or 
+//	deleted while it is, as it can be with POSIX mmap.
+//
+//	Parameters:
+//		path: the name of the file.
+//		newSize: the size of the file and of the mapping, in bytes.
+//***************************************************************************
+bool MappedFile::Open(const std::string& path, long long newSize)
+{
+	Close();
+	
+#ifdef _WIN32
+	file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 
+	                   FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+	                   NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		cerr << "Unable to open " << path << "." << endl;
+		return false;
+	}
+	
+	mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, 
+	                             (DWORD)(newSize >> 32), 
+	                             (DWORD)(newSize & 0xFFFFFFFF), NULL);
+	if (mapping != NULL)
+	{
+		data = (char*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 
+		                            (SIZE_T)newSize);
+	}
+#else
+	fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+	{
+		cerr << "Unable to open " << path << "." << endl;
+		return false;
+	}
+	
+	struct stat info;
+	if (fstat(fd, &info) == 0 && 
+	    (info.st_size == newSize || ftruncate(fd, newSize) == 0))
+	{
+		void* address = mmap(NULL, (size_t)newSize, PROT_READ | PROT_WRITE, 
+		                     MAP_SHARED, fd, 0);
+		if (address != MAP_FAILED)
+		{
+			data = (char*)address;
+		}
+	}
+#endif
+
+	if (data == NULL)
+	{
+		cerr << "Unable to map " << path << "." << endl;
+		Close();
+		return false;
+	}
+	
+	size = newSize;
+	return true;
+}
+
+//***************************************************************************
+//		Method to unmap and close the file.  Changes already written through
+//	Data() stay in the page cache and reach the disk in time even if the 
+//	process dies; call Sync first to force them out now.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (data != NULL)
+	{
+		UnmapViewOfFile(data);
+	}
+	if (mapping != NULL)
+	{
+		CloseHandle(mapping);
+	}
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(file);
+	}
+	mapping = NULL;
+	file = INVALID_HANDLE_VALUE;
+#else
+	if (data != NULL)
+	{
+		munmap(data, (size_t)size);
+	}
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+	fd = -1;
+#endif
+	data = NULL;
+	size = 0;
+}
+
+//***************************************************************************
+//		Method to write every changed page of the mapping to the disk and 
+//	wait for it.  Returns false if the file is not open or the flush failed.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+bool MappedFile::Sync()
+{
+	if (data == NULL)
+	{
+		return false;
+	}
+	
+#ifdef _WIN32
+	return (FlushViewOfFile(data, 0) && FlushFileBuffers(file));
+#else
+	return (msync(data, (size_t)size, MS_SYNC) == 0);
+#endif
+}
+
+//***************************************************************************
+//		Method to tell the operating system the mapping will be read front 
+//	to back, so it reads ahead aggressively and drops pages behind.  Has no
+//	effect where the hint is not supported.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+void MappedFile::AdviseSequential()
+{
+#ifndef _WIN32
+	if (data != NULL)
+	{
+		madvise(data, (size_t)size, MADV_SEQUENTIAL);
+	}
+#endif
+}
+
+//***************************************************************************
+//		Method to return true if a file exists at path.
+//
+//	Parameters:
+//		path: the name of the file.
+//***************************************************************************
+bool MappedFile::Exists(const std::string& path)
+{
+	FILE* file = fopen(path.c_str(), "rb");
+	
+	if (file == NULL)
+	{
+		return false;
+	}
+	fclose(file);
+	return true;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+MappedFile::~MappedFile()
+{
+	Close();
+}
@@ -0,0 +1,54 @@
+//***************************************************************************
+//	Header File for Memory Mapped File
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+using namespace std;
+
+//***************************************************************************
+//	A file mapped read/write into memory.  Reads and writes go straight to
+//	the page cache through Data(), with no system call or copy per access.
+//	Hides the difference between the Windows file mapping calls and POSIX
+//	mmap.
+//***************************************************************************
+class MappedFile
+{
+public:
+	MappedFile();
+	
+	bool Open(const std::string& path, long long newSize);
+	void Close();
+	bool Sync();
+	void AdviseSequential();
+	
+	char* Data() const { return data; }
+	long long Size() const { return size; }
+	bool IsOpen() const { return (data != NULL); }
+	
+	static bool Exists(const std::string& path);
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile();
+
+private:
+#ifdef _WIN32
+	HANDLE    file;
+	HANDLE    mapping;
+#else
+	int       fd;
+#endif
+	char*     data;
+	long long size;
+};
+#endif
@@ -7,37 +7,94 @@
 #include "Queue.h"
 
 //***************************************************************************
-//		Method to insert a new item at the end of the queue.  If the new 
-//	node cannot be created due to a bad allocation error, a message will
-//	be displayed.   
+//		Method to insert a new item at the end of the queue.  The tail 
+//	pointer is kept so this does not walk the chain.  If the new node cannot
+//	be created due to a bad allocation error, a message will be displayed 
+//	and false returned.
 //
 //	Parameters:
-//		N/A.
+//		item: the element to be added.
 //***************************************************************************
 template<class T>
-void Queue<T>::Enqueue(T item)
+bool Queue<T>::Enqueue(T item)
 {
 	try
 	{
-		QNode<T>* tail = new QNode<T>(item, NULL);
-		if (head != NULL)
+		QNode<T>* newNode = new QNode<T>(item, NULL);
+		if (tail != NULL)
 		{
-			QNode<T>* temp = head;
-			while (temp->next != NULL)
-			{
-				temp = temp->next;
-			}
-			temp->next = tail;
+			tail->next = newNode;
 		}
 		else
 		{
-			head = tail;
+			head = newNode;
 		}
+		tail = newNode;
+		count = count + 1;
 	}
 	catch (bad_alloc & ex)
 	{
 		cerr << "Failed to enqueue " << item << " into the Queue." << endl;
+		return false;
+	}
+	return true;
+}
+
+//***************************************************************************
+//		Method to insert numItems items at the end of the queue, in order.
+//	The new nodes are linked into a chain of their own and spliced onto the
+//	tail in one step.  If any node cannot be created, a message will be 
+//	displayed, none of the items will be added and false returned.
+//
+//	Parameters:
+//		items: the elements to be added.
+//		numItems: the number of elements in items.
+//***************************************************************************
+template<class T>
+bool Queue<T>::EnqueueRange(const T* items, int numItems)
+{
+	QNode<T>* first = NULL;
+	QNode<T>* last  = NULL;
+	
+	if (numItems <= 0)
+	{
+		return true;
+	}
+	
+	try
+	{
+		first = new QNode<T>(items[0], NULL);
+		last = first;
+		for (int i = 1; i < numItems; i++)
+		{
+			last->next = new QNode<T>(items[i], NULL);
+			last = last->next;
+		}
+	}
+	catch (bad_alloc & ex)
+	{
+		while (first != NULL)
+		{
+			QNode<T>* temp = first->next;
+			delete first;
+			first = temp;
+		}
+		cerr << "Failed to enqueue " << numItems << " items into the Queue." 
+		     << endl;
+		return false;
 	}
+	
+	if (tail != NULL)
+	{
+		tail->next = first;
+	}
+	else
+	{
+		head = first;
+	}
+	tail = last;
+	count = count + numItems;
+	return true;
 }
 
 //***************************************************************************
@@ -53,53 +110,107 @@ void Queue<T>::Dequeue()
 	{
 		QNode<T>* temp = head;
 		head = head->next;
-		delete[] temp;
+		if (head == NULL)
+		{
+			tail = NULL;
+		}
+		delete temp;
+		count = count - 1;
 	}
 }
 
 //***************************************************************************
-//		Method to return the item at the front of the queue.    
+//		Method to remove the item at the front of the queue and return it
+//	in one step.  The value is moved out of the node rather than copied.
+//	If the queue is empty, a default value is returned.
 //
 //	Parameters:
 //		N/A.
 //***************************************************************************
 template<class T>
-T Queue<T>::Peek() const
+T Queue<T>::DequeueValue()
 {
-	if (head != NULL)
+	T item = T();
+	
+	TryDequeue(item);
+	return item;
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out and 
+//	remove it from the queue.  Returns false, leaving out untouched, if the
+//	queue is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool Queue<T>::TryDequeue(T& out)
+{
+	if (head == NULL)
 	{
-		return head->data;
+		return false;
 	}
-	else
+	
+	QNode<T>* temp = head;
+	out = std::move(temp->data);
+	head = head->next;
+	if (head == NULL)
 	{
-		return T(NULL);
+		tail = NULL;
 	}
+	delete temp;
+	count = count - 1;
+	return true;
 }
 
 //***************************************************************************
-//		Method to return the size of the queue.      
+//		Method to move up to maxItems items from the front of the queue into
+//	out, in order, and remove them from the queue.  Returns the number of 
+//	items moved, which is less than maxItems only if the queue ran empty.
 //
 //	Parameters:
-//		N/A.
+//		out: receives the elements; must hold at least maxItems.
+//		maxItems: the largest number of elements to remove.
 //***************************************************************************
 template<class T>
-int Queue<T>::Size() const
+int Queue<T>::DequeueBatch(T* out, int maxItems)
 {
-	int size = 0;
+	int moved = 0;
+	
+	while (head != NULL && moved < maxItems)
+	{
+		QNode<T>* temp = head;
+		out[moved] = std::move(temp->data);
+		head = head->next;
+		delete temp;
+		moved = moved + 1;
+	}
 	
 	if (head == NULL)
 	{
-		return 0;
-	}	
+		tail = NULL;
+	}
+	count = count - moved;
+	return moved;
+}
+
+//***************************************************************************
+//		Method to return the item at the front of the queue.    
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+T Queue<T>::Peek() const
+{
+	if (head != NULL)
+	{
+		return head->data;
+	}
 	else
 	{
-		QNode<T>* temp = head;
-		while (temp != NULL)
-		{
-			temp = temp->next;
-			size = size + 1;
-		}
-		return size;
+		return T(NULL);
 	}
 }
 
@@ -172,10 +283,13 @@ void Queue<T>::Print() const
 }
 
 //***************************************************************************
-//		Destructor.
+//		Method to remove and deallocate every item in the queue.
+//
+//	Parameters:
+//		N/A.
 //***************************************************************************
 template<class T>
-Queue<T>::~Queue()
+void Queue<T>::Clear()
 {
     while(head != NULL)
 	{
@@ -184,6 +298,17 @@ Queue<T>::~Queue()
         head = temp;
     }
     head = NULL;   
+    tail = NULL;
+    count = 0;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T>
+Queue<T>::~Queue()
+{
+	Clear();
 }
 
 template class Queue<int>;
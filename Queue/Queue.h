@@ -8,6 +8,7 @@
 #define _QUEUE_H
 
 #include <iostream>
+#include <utility>
 using namespace std;
 
 template<class T>
@@ -30,13 +31,18 @@ template<class T>
 class Queue
 {
 public:
-	Queue():head(NULL){}
+	Queue():head(NULL), tail(NULL), count(0){}
 	
-	void Enqueue(T item);
+	bool Enqueue(T item);
+	bool EnqueueRange(const T* items, int numItems);
 	void Dequeue();
+	T DequeueValue();
+	bool TryDequeue(T& out);
+	int DequeueBatch(T* out, int maxItems);
 	T Peek() const;
 	bool IsEmpty() const { return (head == NULL); }
-	int Size() const;
+	int Size() const { return count; }
+	void Clear();
 	
 	QNode<T>* Search(T item) const;	
 	void Print() const;
@@ -45,5 +51,7 @@ public:
 
 private:	                                  
 	QNode<T>* head;
+	QNode<T>* tail;
+	int count;
 };
 #endif
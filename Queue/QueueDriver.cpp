@@ -154,7 +154,7 @@ void choose(Queue<T>& myQueue)
 			}
 			case 'd': case 'D':
 			{
-				myQueue.~Queue();
+				myQueue.Clear();
 				break;
 			}
             case 'q': case 'Q':
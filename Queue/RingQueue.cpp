@@ -0,0 +1,325 @@
+//***************************************************************************
+//	Implementation File for Templated Ring Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "RingQueue.h"
+
+//***************************************************************************
+//		Constructor.  The initial capacity is rounded up to a power of two.
+//	A fixed capacity queue allocates its buffer here and never grows, so it
+//	is given at least RING_QUEUE_MIN_CAPACITY slots.
+//
+//	Parameters:
+//		initialCapacity: the number of items to allocate room for.
+//		fixed: true if a full queue should reject enqueues.
+//***************************************************************************
+template<class T>
+RingQueue<T>::RingQueue(int initialCapacity, bool fixed)
+	: items(NULL), head(0), count(0), capacity(0), mask(0), 
+	  fixedCapacity(false)
+{
+	if (fixed && initialCapacity <= 0)
+	{
+		initialCapacity = RING_QUEUE_MIN_CAPACITY;
+	}
+	
+	if (initialCapacity > 0)
+	{
+		Reserve(initialCapacity);
+	}
+	fixedCapacity = fixed;
+}
+
+//***************************************************************************
+//		Method to insert a new item at the end of the queue.  If the buffer
+//	is full, a growable queue doubles it first, while a fixed capacity queue
+//	returns false and leaves the queue unchanged.  If a bad allocation error
+//	is detected, or the buffer is already at RING_QUEUE_MAX_CAPACITY, a 
+//	message will be displayed and false returned.
+//
+//	Parameters:
+//		item: the element to be added.
+//***************************************************************************
+template<class T>
+bool RingQueue<T>::Enqueue(T item)
+{
+	if (count == capacity)
+	{
+		if (fixedCapacity)
+		{
+			return false;
+		}
+		
+		if (capacity >= RING_QUEUE_MAX_CAPACITY)
+		{
+			cerr << "Failed to enqueue " << item << ", the Queue is full." << endl;
+			return false;
+		}
+		
+		try
+		{
+			Reserve(capacity == 0 ? RING_QUEUE_MIN_CAPACITY : capacity * 2);
+		}
+		catch (bad_alloc & ex)
+		{
+			cerr << "Failed to enqueue " << item << " into the Queue." << endl;
+			return false;
+		}
+	}
+	
+	items[(head + count) & mask] = std::move(item);
+	count = count + 1;
+	return true;
+}
+
+//***************************************************************************
+//		Method to remove the item at the front of the queue.   
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void RingQueue<T>::Dequeue()
+{
+	if (count != 0)
+	{
+		head = (head + 1) & mask;
+		count = count - 1;
+	}
+}
+
+//***************************************************************************
+//		Method to remove the item at the front of the queue and return it
+//	in one step.  If the queue is empty, a default value is returned.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+T RingQueue<T>::DequeueValue()
+{
+	T item = T();
+	
+	TryDequeue(item);
+	return item;
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out and 
+//	remove it from the queue.  Returns false, leaving out untouched, if the
+//	queue is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool RingQueue<T>::TryDequeue(T& out)
+{
+	if (count == 0)
+	{
+		return false;
+	}
+	
+	out = std::move(items[head]);
+	head = (head + 1) & mask;
+	count = count - 1;
+	return true;
+}
+
+//***************************************************************************
+//		Method to return the item at the front of the queue.  If the queue
+//	is empty, a default value is returned.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+T RingQueue<T>::Peek() const
+{
+	if (count == 0)
+	{
+		return T();
+	}
+	return items[head];
+}
+
+//***************************************************************************
+//		Method to grow the buffer so it can hold at least newCapacity items.
+//	The capacity is rounded up to a power of two.  The ring is unwrapped 
+//	while it is moved, so the front item lands in slot 0 of the new buffer.
+//	Requests that do not grow the buffer, or any request on a fixed capacity
+//	queue, are ignored.  May throw bad_alloc, in which case the queue is 
+//	unchanged; this includes requests above RING_QUEUE_MAX_CAPACITY.
+//
+//	Parameters:
+//		newCapacity: the number of items the queue should be able to hold.
+//***************************************************************************
+template<class T>
+void RingQueue<T>::Reserve(int newCapacity)
+{
+	if (fixedCapacity || newCapacity <= capacity)
+	{
+		return;
+	}
+	
+	if (newCapacity > RING_QUEUE_MAX_CAPACITY)
+	{
+		throw bad_alloc();
+	}
+	
+	newCapacity = RoundUpPow2(newCapacity);
+	T* newItems = new T[newCapacity];
+	
+	for (int i = 0; i < count; i++)
+	{
+		newItems[i] = std::move(items[(head + i) & mask]);
+	}
+	
+	delete[] items;
+	items = newItems;
+	head = 0;
+	capacity = newCapacity;
+	mask = newCapacity - 1;
+}
+
+//***************************************************************************
+//		Method that will return true if the item is in the queue, and false
+//	otherwise.  The search starts at the front of the queue.
+//
+//	Parameters:
+//		item: the element to be searched for.
+//***************************************************************************
+template<class T>
+bool RingQueue<T>::Search(T item) const
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (items[(head + i) & mask] == item)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//***************************************************************************
+//		Method that will print the contents of the queue.  The front 
+//	element will be enclosed in square brackets to denote the start of the
+//	queue.     
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void RingQueue<T>::Print() const
+{
+	if (count == 0)
+	{
+		return;
+	}
+	
+	cout << "-------------" << endl;
+	cout << "[" << items[head] << "]," << endl;
+	
+	for (int i = 1; i < count; i++)
+	{
+		cout << items[(head + i) & mask] << "," << endl;
+	}
+	cout << "-------------" << endl;
+}
+
+//***************************************************************************
+//		Method to return the smallest power of two that is at least value.
+//	The result stops at RING_QUEUE_MAX_CAPACITY, since shifting past it
+//	would overflow an int.
+//
+//	Parameters:
+//		value: the requested capacity.
+//***************************************************************************
+template<class T>
+int RingQueue<T>::RoundUpPow2(int value)
+{
+	int result = 1;
+	
+	while (result < value && result < RING_QUEUE_MAX_CAPACITY)
+	{
+		result = result << 1;
+	}
+	return result;
+}
+
+//***************************************************************************
+//		Copy Constructor.  The copy keeps the capacity mode of the original.
+//***************************************************************************
+template<class T>
+RingQueue<T>::RingQueue(const RingQueue<T>& myQueue)
+	: items(NULL), head(0), count(0), capacity(0), mask(0), 
+	  fixedCapacity(false)
+{
+	if (myQueue.capacity > 0)
+	{
+		Reserve(myQueue.capacity);
+	}
+	
+	for (int i = 0; i < myQueue.count; i++)
+	{
+		items[i] = myQueue.items[(myQueue.head + i) & myQueue.mask];
+	}
+	count = myQueue.count;
+	fixedCapacity = myQueue.fixedCapacity;
+}
+
+//***************************************************************************
+//		Assignment Operator.  The buffer is reallocated to match the other
+//	queue, and the capacity mode is copied along with the items.
+//***************************************************************************
+template<class T>
+RingQueue<T>& RingQueue<T>::operator=(const RingQueue<T>& myQueue)
+{
+	if (this == &myQueue)
+	{
+		return *this;
+	}
+	
+	T* newItems = NULL;
+	if (myQueue.capacity > 0)
+	{
+		newItems = new T[myQueue.capacity];
+	}
+	
+	for (int i = 0; i < myQueue.count; i++)
+	{
+		newItems[i] = myQueue.items[(myQueue.head + i) & myQueue.mask];
+	}
+	
+	delete[] items;
+	items = newItems;
+	head = 0;
+	count = myQueue.count;
+	capacity = myQueue.capacity;
+	mask = myQueue.mask;
+	fixedCapacity = myQueue.fixedCapacity;
+	return *this;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T>
+RingQueue<T>::~RingQueue()
+{
+	delete[] items;
+	items = NULL;
+	head = 0;
+	count = 0;
+	capacity = 0;
+}
+
+template class RingQueue<int>;
+template class RingQueue<double>;
+template class RingQueue<float>;
+template class RingQueue<char>;
+template class RingQueue<bool>;
+template class RingQueue<string>;
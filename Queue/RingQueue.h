@@ -0,0 +1,65 @@
+//***************************************************************************
+//	Header File for Templated Ring Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _RINGQUEUE_H
+#define _RINGQUEUE_H
+
+#include <iostream>
+#include <string>
+#include <utility>
+using namespace std;
+
+// Number of slots allocated by the first enqueue onto an empty queue.
+#define RING_QUEUE_MIN_CAPACITY 16
+
+// Largest capacity a queue can grow to, the biggest power of two an int
+// can hold.
+#define RING_QUEUE_MAX_CAPACITY (1 << 30)
+
+//***************************************************************************
+//	Queue that keeps its elements in one circular buffer.  The capacity is
+//	always a power of two, so wrapping an index is a mask instead of a 
+//	division.  A growable queue doubles its buffer when full; a fixed 
+//	capacity queue rejects the enqueue instead.
+//***************************************************************************
+template<class T>
+class RingQueue
+{
+public:
+	RingQueue(int initialCapacity = 0, bool fixed = false);
+	
+	bool Enqueue(T item);
+	void Dequeue();
+	T DequeueValue();
+	bool TryDequeue(T& out);
+	T Peek() const;
+	bool IsEmpty() const { return (count == 0); }
+	bool IsFull() const { return (count == capacity); }
+	int Size() const { return count; }
+	
+	void Reserve(int newCapacity);
+	int Capacity() const { return capacity; }
+	bool IsFixed() const { return fixedCapacity; }
+	void Clear() { head = 0; count = 0; }
+	
+	bool Search(T item) const;
+	void Print() const;
+
+	RingQueue(const RingQueue& myQueue);
+	RingQueue& operator=(const RingQueue& myQueue);
+	~RingQueue();
+
+private:
+	T*   items;
+	int  head;
+	int  count;
+	int  capacity;
+	int  mask;
+	bool fixedCapacity;
+	
+	static int RoundUpPow2(int value);
+};
+#endif
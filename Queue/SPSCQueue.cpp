@@ -0,0 +1,210 @@
+//***************************************************************************
+//	Implementation File for Templated Single Producer Single Consumer Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "SPSCQueue.h"
+
+//***************************************************************************
+//		Constructor.  The capacity is rounded up to a power of two, and the
+//	whole buffer is allocated here so neither thread ever allocates.  The 
+//	indices run freely and are masked on use, so head == tail means empty
+//	and tail - head == capacity means full.  The capacity is capped at
+//	SPSC_MAX_CAPACITY.
+//
+//	Parameters:
+//		newCapacity: the number of items the queue should be able to hold.
+//***************************************************************************
+template<class T>
+SPSCQueue<T>::SPSCQueue(int newCapacity)
+	: items(NULL), capacity(1), mask(0), head(0), cachedTail(0), tail(0), 
+	  cachedHead(0)
+{
+	while ((int)capacity < newCapacity && capacity < SPSC_MAX_CAPACITY)
+	{
+		capacity = capacity << 1;
+	}
+	mask = capacity - 1;
+	items = new T[capacity];
+}
+
+//***************************************************************************
+//		Producer method to add an item at the end of the queue.  Returns 
+//	false, leaving the queue unchanged, if the queue is full.
+//
+//	Parameters:
+//		item: the element to be added.
+//***************************************************************************
+template<class T>
+bool SPSCQueue<T>::TryEnqueue(T item)
+{
+	unsigned int myTail = tail.load(std::memory_order_relaxed);
+	
+	if (myTail - cachedHead == capacity)
+	{
+		cachedHead = head.load(std::memory_order_acquire);
+		if (myTail - cachedHead == capacity)
+		{
+			return false;
+		}
+	}
+	
+	items[myTail & mask] = std::move(item);
+	tail.store(myTail + 1, std::memory_order_release);
+	return true;
+}
+
+//***************************************************************************
+//		Consumer method to move the item at the front of the queue into out
+//	and remove it.  Returns false, leaving out untouched, if the queue is 
+//	empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool SPSCQueue<T>::TryDequeue(T& out)
+{
+	unsigned int myHead = head.load(std::memory_order_relaxed);
+	
+	if (myHead == cachedTail)
+	{
+		cachedTail = tail.load(std::memory_order_acquire);
+		if (myHead == cachedTail)
+		{
+			return false;
+		}
+	}
+	
+	out = std::move(items[myHead & mask]);
+	head.store(myHead + 1, std::memory_order_release);
+	return true;
+}
+
+//***************************************************************************
+//		Producer method to add as many of the items as will fit, in order, 
+//	and publish them all with one store.  Returns the number of items added,
+//	which is zero if numItems is not positive.
+//
+//	Parameters:
+//		newItems: the elements to be added.
+//		numItems: the number of elements in newItems.
+//***************************************************************************
+template<class T>
+int SPSCQueue<T>::EnqueueBatch(const T* newItems, int numItems)
+{
+	if (numItems <= 0)
+	{
+		return 0;
+	}
+	
+	unsigned int myTail = tail.load(std::memory_order_relaxed);
+	unsigned int room   = capacity - (myTail - cachedHead);
+	
+	if (room < (unsigned int)numItems)
+	{
+		cachedHead = head.load(std::memory_order_acquire);
+		room = capacity - (myTail - cachedHead);
+	}
+	
+	int added = (room < (unsigned int)numItems) ? (int)room : numItems;
+	for (int i = 0; i < added; i++)
+	{
+		items[(myTail + i) & mask] = newItems[i];
+	}
+	
+	if (added > 0)
+	{
+		tail.store(myTail + added, std::memory_order_release);
+	}
+	return added;
+}
+
+//***************************************************************************
+//		Consumer method to move up to maxItems items from the front of the 
+//	queue into out, in order, and release their slots with one store.  
+//	Returns the number of items moved, which is zero if maxItems is not 
+//	positive.
+//
+//	Parameters:
+//		out: receives the elements; must hold at least maxItems.
+//		maxItems: the largest number of elements to remove.
+//***************************************************************************
+template<class T>
+int SPSCQueue<T>::DequeueBatch(T* out, int maxItems)
+{
+	if (maxItems <= 0)
+	{
+		return 0;
+	}
+	
+	unsigned int myHead    = head.load(std::memory_order_relaxed);
+	unsigned int available = cachedTail - myHead;
+	
+	if (available < (unsigned int)maxItems)
+	{
+		cachedTail = tail.load(std::memory_order_acquire);
+		available = cachedTail - myHead;
+	}
+	
+	int moved = (available < (unsigned int)maxItems) ? (int)available 
+	                                                 : maxItems;
+	for (int i = 0; i < moved; i++)
+	{
+		out[i] = std::move(items[(myHead + i) & mask]);
+	}
+	
+	if (moved > 0)
+	{
+		head.store(myHead + moved, std::memory_order_release);
+	}
+	return moved;
+}
+
+//***************************************************************************
+//		Method to return true if the queue held no items at the moment it 
+//	was checked.  Either thread may call this.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool SPSCQueue<T>::IsEmpty() const
+{
+	return (head.load(std::memory_order_acquire) == 
+	        tail.load(std::memory_order_acquire));
+}
+
+//***************************************************************************
+//		Method to return the number of items in the queue.  While the other
+//	thread is running the value is only a snapshot.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+int SPSCQueue<T>::Size() const
+{
+	unsigned int myHead = head.load(std::memory_order_acquire);
+	unsigned int myTail = tail.load(std::memory_order_acquire);
+	
+	return (int)(myTail - myHead);
+}
+
+//***************************************************************************
+//		Destructor.  Must only run once both threads are done with the queue.
+//***************************************************************************
+template<class T>
+SPSCQueue<T>::~SPSCQueue()
+{
+	delete[] items;
+	items = NULL;
+}
+
+template class SPSCQueue<int>;
+template class SPSCQueue<double>;
+template class SPSCQueue<float>;
+template class SPSCQueue<char>;
+template class SPSCQueue<bool>;
+template class SPSCQueue<string>;
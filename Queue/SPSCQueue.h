@@ -0,0 +1,69 @@
+//***************************************************************************
+//	Header File for Templated Single Producer Single Consumer Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _SPSCQUEUE_H
+#define _SPSCQUEUE_H
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <utility>
+using namespace std;
+
+// Size of a cache line.  The producer and consumer indices are kept on 
+// separate lines so that writing one never invalidates the other.
+#define SPSC_CACHE_LINE 64
+
+// Largest capacity a queue can have, the biggest power of two an int can
+// hold.  Larger requests are capped to it.
+#define SPSC_MAX_CAPACITY (1 << 30)
+
+//***************************************************************************
+//	Bounded ring queue shared by exactly one producer thread and exactly 
+//	one consumer thread.  Neither side ever waits on the other: every call
+//	finishes in a fixed number of steps and returns false if the queue is
+//	full or empty.
+//
+//	The producer owns tail and the consumer owns head.  Each side also keeps
+//	its own copy of the other side's index and only reloads the shared one
+//	when that copy says the queue is full (or empty), so in the steady state
+//	each side only touches its own cache line.  The batch calls publish or
+//	release a whole run of slots with a single index store.
+//***************************************************************************
+template<class T>
+class SPSCQueue
+{
+public:
+	SPSCQueue(int newCapacity = 1024);
+	
+	bool TryEnqueue(T item);
+	bool TryDequeue(T& out);
+	int EnqueueBatch(const T* newItems, int numItems);
+	int DequeueBatch(T* out, int maxItems);
+	
+	bool IsEmpty() const;
+	int Size() const;
+	int Capacity() const { return (int)capacity; }
+
+	SPSCQueue(const SPSCQueue&) = delete;
+	SPSCQueue& operator=(const SPSCQueue&) = delete;
+	~SPSCQueue();
+
+private:
+	// Written once by the constructor, read by both sides.
+	T*           items;
+	unsigned int capacity;
+	unsigned int mask;
+	
+	// Consumer side: its index and its copy of the producer's.
+	alignas(SPSC_CACHE_LINE) std::atomic<unsigned int> head;
+	unsigned int cachedTail;
+	
+	// Producer side: its index and its copy of the consumer's.
+	alignas(SPSC_CACHE_LINE) std::atomic<unsigned int> tail;
+	unsigned int cachedHead;
+};
+#endif
@@ -0,0 +1,419 @@
+//***************************************************************************
+//	Implementation File for Templated Spill Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "SpillQueue.h"
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+//***************************************************************************
+//		Constructor.  Opens or creates the metadata file prefix.meta.  If it
+//	describes a queue of the same element and segment size, the spilled 
+//	items it records are recovered; otherwise a new, empty queue is 
+//	started.  Segment files are named prefix.N.seg.
+//
+//	Parameters:
+//		newPrefix: the path and name prefix of the queue's files.
+//		newHotItems: the number of items to keep in memory at each end.
+//		newSegmentItems: the number of items stored in each segment file.
+//***************************************************************************
+template<class T>
+SpillQueue<T>::SpillQueue(const std::string& newPrefix, int newHotItems,
+                          long long newSegmentItems)
+	: prefix(newPrefix), 
+	  hotItems(newHotItems > 0 ? newHotItems : SPILL_HOT_ITEMS),
+	  segmentItems(newSegmentItems > 0 ? newSegmentItems : SPILL_SEGMENT_ITEMS),
+	  head(hotItems), tail(hotItems), meta(NULL), readSeq(-1), writeSeq(-1)
+{
+	if (!OpenMeta())
+	{
+		cerr << "The queue will not be able to spill to disk." << endl;
+	}
+}
+
+//***************************************************************************
+//		Method to insert a new item at the end of the queue.  Items go into
+//	the head buffer while nothing is queued behind it, and into the tail 
+//	buffer otherwise; a full tail buffer is spilled to disk.  Returns false,
+//	with a message, if the item could not be stored.
+//
+//	Parameters:
+//		item: the element to be added.
+//***************************************************************************
+template<class T>
+bool SpillQueue<T>::Enqueue(T item)
+{
+	if (SpilledCount() == 0 && tail.IsEmpty() && head.Size() < hotItems)
+	{
+		return head.Enqueue(item);
+	}
+	
+	if (tail.Size() >= hotItems && !SpillTail())
+	{
+		cerr << "Failed to enqueue " << item << " into the Queue." << endl;
+		return false;
+	}
+	return tail.Enqueue(item);
+}
+
+//***************************************************************************
+//		Method to remove the item at the front of the queue.   
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void SpillQueue<T>::Dequeue()
+{
+	T item;
+	
+	TryDequeue(item);
+}
+
+//***************************************************************************
+//		Method to move the item at the front of the queue into out and 
+//	remove it.  The item comes from the head buffer, then from the mapped
+//	segments, then from the tail buffer.  Returns false, leaving out 
+//	untouched, if the queue is empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T>
+bool SpillQueue<T>::TryDequeue(T& out)
+{
+	return (DequeueBatch(&out, 1) == 1);
+}
+
+//***************************************************************************
+//		Method to move up to maxItems items from the front of the queue into
+//	out, in order.  Items on disk are copied straight out of the mapped 
+//	segment in one run per segment.  Returns the number of items moved.
+//
+//	Parameters:
+//		out: receives the elements; must hold at least maxItems.
+//		maxItems: the largest number of elements to remove.
+//***************************************************************************
+template<class T>
+int SpillQueue<T>::DequeueBatch(T* out, int maxItems)
+{
+	int moved = 0;
+	
+	while (moved < maxItems && head.TryDequeue(out[moved]))
+	{
+		moved = moved + 1;
+	}
+	
+	while (moved < maxItems && SpilledCount() > 0)
+	{
+		long long seq    = meta->readPos / segmentItems;
+		long long offset = meta->readPos % segmentItems;
+		
+		if (!MapSegment(readSegment, readSeq, seq))
+		{
+			return moved;
+		}
+		
+		long long run = segmentItems - offset;
+		if (run > SpilledCount())
+		{
+			run = SpilledCount();
+		}
+		if (run > maxItems - moved)
+		{
+			run = maxItems - moved;
+		}
+		
+		memcpy((void*)(out + moved), readSegment.Data() + offset * sizeof(T), 
+		       (size_t)run * sizeof(T));
+		moved = moved + (int)run;
+		meta->readPos = meta->readPos + run;
+		
+		if (offset + run == segmentItems)
+		{
+			readSegment.Close();
+			readSeq = -1;
+			RetireSegment(seq);
+		}
+	}
+	
+	if (moved < maxItems && SpilledCount() == 0)
+	{
+		// Nothing is left on disk, so the tail buffer is now the front.
+		while (moved < maxItems && tail.TryDequeue(out[moved]))
+		{
+			moved = moved + 1;
+		}
+	}
+	return moved;
+}
+
+//***************************************************************************
+//		Method to return the number of items in the queue, in memory and on
+//	disk.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+long long SpillQueue<T>::Size() const
+{
+	return head.Size() + SpilledCount() + tail.Size();
+}
+
+//***************************************************************************
+//		Method to return the number of items currently stored on disk.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+long long SpillQueue<T>::SpilledCount() const
+{
+	if (meta == NULL)
+	{
+		return 0;
+	}
+	return meta->writePos - meta->readPos;
+}
+
+//***************************************************************************
+//		Method to spill the tail buffer and force the segment and metadata 
+//	files to disk, so everything but the head buffer survives a crash.  
+//	Returns false if a write or flush failed.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool SpillQueue<T>::Checkpoint()
+{
+	if (!tail.IsEmpty() && !SpillTail())
+	{
+		return false;
+	}
+	
+	bool synced = true;
+	if (writeSegment.IsOpen())
+	{
+		synced = writeSegment.Sync();
+	}
+	return (metaFile.Sync() && synced);
+}
+
+//***************************************************************************
+//		Method to remove every item and delete every file of the queue, 
+//	including recycled segments and the metadata file.  The files are 
+//	created again if the queue needs to spill later.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void SpillQueue<T>::Purge()
+{
+	head.Clear();
+	tail.Clear();
+	readSegment.Close();
+	writeSegment.Close();
+	readSeq = -1;
+	writeSeq = -1;
+	
+	if (meta != NULL)
+	{
+		for (long long seq = meta->readPos / segmentItems; 
+		     seq <= meta->lastSegment; seq++)
+		{
+			remove(SegmentName(seq).c_str());
+		}
+	}
+	
+	metaFile.Close();
+	meta = NULL;
+	remove((prefix + ".meta").c_str());
+}
+
+//***************************************************************************
+//		Method to open or create the metadata file and recover the positions
+//	it records.  Returns false, with a message, if it cannot be mapped.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool SpillQueue<T>::OpenMeta()
+{
+	if (!metaFile.Open(prefix + ".meta", SPILL_META_BYTES))
+	{
+		return false;
+	}
+	
+	meta = (SpillMeta*)metaFile.Data();
+	if (meta->magic == SPILL_META_MAGIC && 
+	    meta->version == SPILL_META_VERSION && 
+	    meta->elemSize == sizeof(T) && meta->segmentItems == segmentItems &&
+	    meta->readPos <= meta->writePos)
+	{
+		return true;
+	}
+	
+	if (meta->magic != 0)
+	{
+		cerr << prefix << ".meta does not match this queue; "
+		     << "starting a new queue." << endl;
+	}
+	
+	meta->version = SPILL_META_VERSION;
+	meta->elemSize = sizeof(T);
+	meta->reserved = 0;
+	meta->segmentItems = segmentItems;
+	meta->readPos = 0;
+	meta->writePos = 0;
+	meta->lastSegment = -1;
+	meta->magic = SPILL_META_MAGIC;
+	return true;
+}
+
+//***************************************************************************
+//		Method to append the whole tail buffer to the end of the segment 
+//	files, one run per segment.  The write position is recorded after each
+//	run is copied, so a crash never exposes an unwritten item.  Returns 
+//	false if the metadata or a segment could not be mapped; items already
+//	spilled stay spilled.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool SpillQueue<T>::SpillTail()
+{
+	if (meta == NULL && !OpenMeta())
+	{
+		return false;
+	}
+	
+	while (!tail.IsEmpty())
+	{
+		long long seq    = meta->writePos / segmentItems;
+		long long offset = meta->writePos % segmentItems;
+		
+		if (!MapSegment(writeSegment, writeSeq, seq))
+		{
+			return false;
+		}
+		
+		T*        slots = (T*)(writeSegment.Data()) + offset;
+		long long run   = 0;
+		while (offset + run < segmentItems && tail.TryDequeue(slots[run]))
+		{
+			run = run + 1;
+		}
+		meta->writePos = meta->writePos + run;
+	}
+	return true;
+}
+
+//***************************************************************************
+//		Method to make sure segment seq is the one mapped in segment.  A 
+//	segment beyond the last one on disk is created and recorded in the 
+//	metadata; an existing or recycled one is reopened as it is.
+//
+//	Parameters:
+//		segment: the mapping to use.
+//		openSeq: the segment number currently mapped there; updated.
+//		seq: the segment number wanted.
+//***************************************************************************
+template<class T>
+bool SpillQueue<T>::MapSegment(MappedFile& segment, long long& openSeq, 
+                               long long seq)
+{
+	if (openSeq == seq && segment.IsOpen())
+	{
+		return true;
+	}
+	
+	if (!segment.Open(SegmentName(seq), segmentItems * sizeof(T)))
+	{
+		openSeq = -1;
+		return false;
+	}
+	
+	if (&segment == &readSegment)
+	{
+		segment.AdviseSequential();
+	}
+	if (seq > meta->lastSegment)
+	{
+		meta->lastSegment = seq;
+	}
+	openSeq = seq;
+	return true;
+}
+
+//***************************************************************************
+//		Method to dispose of a segment that has been read to the end.  If 
+//	fewer than SPILL_MAX_RECYCLED segments are waiting beyond the write 
+//	position, the file is renamed to the next segment number so a later 
+//	write reuses it without creating a file; otherwise it is deleted.
+//
+//	Parameters:
+//		seq: the segment number that was read to the end.
+//***************************************************************************
+template<class T>
+void SpillQueue<T>::RetireSegment(long long seq)
+{
+	long long writingSeq = meta->writePos / segmentItems;
+	
+	if (seq == writeSeq)
+	{
+		writeSegment.Close();
+		writeSeq = -1;
+	}
+	
+	if (meta->lastSegment - writingSeq < SPILL_MAX_RECYCLED &&
+	    rename(SegmentName(seq).c_str(), 
+	           SegmentName(meta->lastSegment + 1).c_str()) == 0)
+	{
+		meta->lastSegment = meta->lastSegment + 1;
+	}
+	else
+	{
+		remove(SegmentName(seq).c_str());
+	}
+}
+
+//***************************************************************************
+//		Method to return the file name of segment seq.
+//
+//	Parameters:
+//		seq: the segment number.
+//***************************************************************************
+template<class T>
+std::string SpillQueue<T>::SegmentName(long long seq) const
+{
+	std::ostringstream name;
+	
+	name << prefix << "." << seq << ".seg";
+	return name.str();
+}
+
+//***************************************************************************
+//		Destructor.  The files are kept, so a queue opened later with the 
+//	same prefix resumes with the spilled items.
+//***************************************************************************
+template<class T>
+SpillQueue<T>::~SpillQueue()
+{
+	readSegment.Close();
+	writeSegment.Close();
+	metaFile.Close();
+}
+
+template class SpillQueue<int>;
+template class SpillQueue<double>;
+template class SpillQueue<float>;
+template class SpillQueue<char>;
+template class SpillQueue<bool>;
@@ -0,0 +1,104 @@
+//***************************************************************************
+//	Header File for Templated Spill Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _SPILLQUEUE_H
+#define _SPILLQUEUE_H
+
+#include "RingQueue.h"
+#include "MappedFile.h"
+#include <iostream>
+#include <string>
+using namespace std;
+
+// Default number of items kept in memory at each end of the queue, and 
+// number of items stored in each segment file.
+#define SPILL_HOT_ITEMS      65536
+#define SPILL_SEGMENT_ITEMS  (1 << 20)
+
+// Number of consumed segment files kept, renamed, for later writes.
+#define SPILL_MAX_RECYCLED   2
+
+#define SPILL_META_MAGIC     0x4C505351
+#define SPILL_META_VERSION   1
+#define SPILL_META_BYTES     4096
+
+// Layout of the metadata file.  Positions count items from the first item
+// ever written; item p lives in segment p / segmentItems.
+struct SpillMeta
+{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int elemSize;
+	unsigned int reserved;
+	long long    segmentItems;
+	long long    readPos;
+	long long    writePos;
+	long long    lastSegment;
+};
+
+//***************************************************************************
+//	Queue that holds a bounded number of items in memory and spills the 
+//	rest to disk, so a stalled consumer costs disk space instead of RAM.
+//
+//	The oldest items sit in an in-memory head buffer and the newest in an
+//	in-memory tail buffer; everything in between lives in append-only 
+//	segment files mapped into memory.  When the tail buffer fills, it is 
+//	copied to the end of the current segment.  Once the head buffer is 
+//	empty, dequeues read straight out of the mapped segments, front to 
+//	back.  A segment that has been read to the end is renamed and reused
+//	for a later write, up to SPILL_MAX_RECYCLED of them, or deleted.
+//
+//	The read and write positions live in a mapped metadata file and are 
+//	updated as items move, so a queue reopened with the same path prefix
+//	after the process dies resumes with every spilled item not yet 
+//	dequeued.  Items still in the in-memory buffers are lost; Checkpoint 
+//	spills the tail buffer and syncs the files.
+//
+//	T must be trivially copyable, since items are stored as raw bytes.
+//***************************************************************************
+template<class T>
+class SpillQueue
+{
+public:
+	SpillQueue(const std::string& newPrefix, int newHotItems = SPILL_HOT_ITEMS,
+	           long long newSegmentItems = SPILL_SEGMENT_ITEMS);
+	
+	bool Enqueue(T item);
+	void Dequeue();
+	bool TryDequeue(T& out);
+	int DequeueBatch(T* out, int maxItems);
+	
+	bool IsEmpty() const { return (Size() == 0); }
+	long long Size() const;
+	long long SpilledCount() const;
+	
+	bool Checkpoint();
+	void Purge();
+
+	SpillQueue(const SpillQueue&) = delete;
+	SpillQueue& operator=(const SpillQueue&) = delete;
+	~SpillQueue();
+
+private:
+	std::string  prefix;
+	int          hotItems;
+	long long    segmentItems;
+	RingQueue<T> head;
+	RingQueue<T> tail;
+	MappedFile   metaFile;
+	SpillMeta*   meta;
+	MappedFile   readSegment;
+	MappedFile   writeSegment;
+	long long    readSeq;
+	long long    writeSeq;
+	
+	bool OpenMeta();
+	bool SpillTail();
+	bool MapSegment(MappedFile& segment, long long& openSeq, long long seq);
+	void RetireSegment(long long seq);
+	std::string SegmentName(long long seq) const;
+};
+#endif
@@ -116,6 +116,32 @@ void TestQueue<U>::runTests()
 			testNotFoundSearch();
 			
 			testSearch();
+			
+			testTryDequeue();
+			
+			testBatchOperations();
+			
+			testRingQueue();
+			
+			testBlockingQueue();
+			
+			benchmarkRingQueue();
+			
+			testDeque();
+			
+			benchmarkDeque();
+			
+			testSpillQueue();
+			
+			benchmarkSpillQueue();
+			
+			benchmarkSPSCQueue();
+			
+			benchmarkMPMCQueue();
+			
+			testWorkStealingDeque();
+			
+			benchmarkForkJoin();
 		}
 		else
 		{
@@ -207,7 +233,7 @@ bool TestQueue<U>::testDequeue()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testQueue.~Queue();
+		testQueue.Clear();
 		if (testQueue.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the queue.", OK);
@@ -302,7 +328,7 @@ bool TestQueue<U>::bulkDequeue()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testQueue.~Queue();
+		testQueue.Clear();
 		if (testQueue.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the queue.", OK);
@@ -392,7 +418,7 @@ bool TestQueue<U>::testPeek()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testQueue.~Queue();
+		testQueue.Clear();
 		if (testQueue.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the queue.", OK);
@@ -475,7 +501,7 @@ bool TestQueue<U>::testEmptyQueueSearch()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testQueue.~Queue();
+		testQueue.Clear();
 		if (testQueue.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the queue.", OK);
@@ -560,7 +586,7 @@ bool TestQueue<U>::testNotFoundSearch()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testQueue.~Queue();
+		testQueue.Clear();
 		if (testQueue.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the queue.", OK);
@@ -641,7 +667,7 @@ bool TestQueue<U>::testSearch()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testQueue.~Queue();
+		testQueue.Clear();
 		if (testQueue.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the queue.", OK);
@@ -707,3 +733,1864 @@ bool TestQueue<U>::testSearch()
 	std::cout << std::endl;
 	return status;
 }
+
+//****************************************************************************
+//	NAME: testTryDequeue.
+//
+//	DESCRIPTION: Add 3 items to the queue and remove them with TryDequeue.  The
+//				 items must come back in the order 1, 2, 3, the size must 
+//				 drop by one each time, and TryDequeue must fail once the queue
+//				 is empty.
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testTryDequeue()
+{
+	testLogger.logEvent("***** Begin Try Dequeue Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		testLogger.logEvent("Clearing the queue before further testing.", 
+		                                                           INFO);
+		testQueue.Clear();
+		
+		U value1 = U(1);
+		U value2 = U(2);
+		U value3 = U(3);
+		U out;
+		
+		testLogger.logEvent("Adding 3 values to the queue.", INFO);
+		testQueue.Enqueue(value1);
+		testQueue.Enqueue(value2);
+		testQueue.Enqueue(value3);
+		
+		testLogger.logEvent("Removing the values with TryDequeue.", INFO);
+		if (!testQueue.TryDequeue(out) || out != value1 || testQueue.Size() != 2 ||
+		    !testQueue.TryDequeue(out) || out != value2 || testQueue.Size() != 1 ||
+		    !testQueue.TryDequeue(out) || out != value3 || testQueue.Size() != 0)
+		{
+			testLogger.logEvent("TryDequeue returned the wrong item.", FAIL);
+			status = FAIL;
+		}
+		else if (testQueue.TryDequeue(out))
+		{
+			testLogger.logEvent("TryDequeue succeeded on an empty queue.", FAIL);
+			status = FAIL;
+		}
+		else
+		{
+			testLogger.logEvent("Successfully removed all 3 items.", OK);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "TryDequeue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Try Dequeue Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Try Dequeue Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Try Dequeue Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testBatchOperations.
+//
+//	DESCRIPTION: Add the values 1 to 10 with EnqueueRange, remove 4 with 
+//				 DequeueBatch, add 11 to 15 with another EnqueueRange, and 
+//				 then drain the queue in batches of 4.  Every value must come
+//				 back in order and the last batch must be short.
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testBatchOperations()
+{
+	testLogger.logEvent("***** Begin Batch Operations Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		testLogger.logEvent("Clearing the queue before further testing.", 
+		                                                           INFO);
+		testQueue.Clear();
+		
+		U   values[15];
+		U   out[4];
+		int expected = 1;
+		
+		for (int i = 0; i < 15; i++)
+		{
+			values[i] = U(i + 1);
+		}
+		
+		testLogger.logEvent("Adding 10 values with EnqueueRange.", INFO);
+		testQueue.EnqueueRange(values, 10);
+		
+		testLogger.logEvent("Removing 4 values with DequeueBatch.", INFO);
+		int moved = testQueue.DequeueBatch(out, 4);
+		for (int i = 0; i < moved; i++)
+		{
+			if (out[i] != U(expected))
+			{
+				status = FAIL;
+			}
+			expected = expected + 1;
+		}
+		
+		if (moved != 4 || testQueue.Size() != 6)
+		{
+			testLogger.logEvent("DequeueBatch removed the wrong count.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Adding 5 more values with EnqueueRange.", INFO);
+		testQueue.EnqueueRange(values + 10, 5);
+		
+		testLogger.logEvent("Draining the queue in batches of 4.", INFO);
+		while ((moved = testQueue.DequeueBatch(out, 4)) > 0)
+		{
+			for (int i = 0; i < moved; i++)
+			{
+				if (out[i] != U(expected))
+				{
+					status = FAIL;
+				}
+				expected = expected + 1;
+			}
+		}
+		
+		if (expected != 16 || !testQueue.IsEmpty() || testQueue.Size() != 0)
+		{
+			testLogger.logEvent("Queue did not drain all 15 values.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Enqueueing after the queue was drained.", INFO);
+		testQueue.Enqueue(values[0]);
+		if (testQueue.Peek() != values[0] || testQueue.Size() != 1)
+		{
+			testLogger.logEvent("Enqueue after drain was lost.", FAIL);
+			status = FAIL;
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("All batches came back in order.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("A batch came back out of order.", FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the batch operations.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Batch Operations Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Batch Operations Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Batch Operations Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testRingQueue.
+//
+//	DESCRIPTION: Wrap a growable ring queue around its buffer and then grow 
+//				 it, checking that every value comes back in order.  Then 
+//				 fill a fixed capacity ring queue and check that the next 
+//				 enqueue is rejected until an item is removed.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testRingQueue()
+{
+	testLogger.logEvent("***** Begin Ring Queue Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		RingQueue<U> ringQueue;
+		int          expected = 0;
+		
+		testLogger.logEvent("Wrapping the ring and forcing it to grow.", INFO);
+		for (int i = 0; i < 12; i++)
+		{
+			ringQueue.Enqueue(U(i));
+		}
+		for (int i = 0; i < 10; i++)
+		{
+			if (ringQueue.DequeueValue() != U(expected))
+			{
+				status = FAIL;
+			}
+			expected = expected + 1;
+		}
+		for (int i = 12; i < 40; i++)
+		{
+			ringQueue.Enqueue(U(i));
+		}
+		while (!ringQueue.IsEmpty())
+		{
+			if (ringQueue.DequeueValue() != U(expected))
+			{
+				status = FAIL;
+			}
+			expected = expected + 1;
+		}
+		
+		if (expected != 40 || ringQueue.Capacity() != 32)
+		{
+			testLogger.logEvent("Growing the ring lost values.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Filling a fixed capacity ring queue.", INFO);
+		RingQueue<U> fixedQueue(8, true);
+		for (int i = 0; i < 8; i++)
+		{
+			fixedQueue.Enqueue(U(i));
+		}
+		
+		if (fixedQueue.Enqueue(U(8)) || fixedQueue.Size() != 8)
+		{
+			testLogger.logEvent("Full fixed queue accepted an item.", FAIL);
+			status = FAIL;
+		}
+		
+		fixedQueue.Dequeue();
+		if (!fixedQueue.Enqueue(U(8)) || fixedQueue.Peek() != U(1))
+		{
+			testLogger.logEvent("Fixed queue rejected after a dequeue.", FAIL);
+			status = FAIL;
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("Ring queues kept every value in order.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("A ring queue returned a wrong value.", FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the ring queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Ring Queue Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Ring Queue Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Ring Queue Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkRingQueue.
+//
+//	DESCRIPTION: Enqueue and then dequeue 1,000,000 items on the linked 
+//				 queue and on the ring queue, then stream another 1,000,000
+//				 items through each with a steady depth of 64, and display 
+//				 the time taken by each.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::benchmarkRingQueue()
+{
+	testLogger.logEvent("***** Begin Ring Queue Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int BENCH_SIZE  = 1000000;
+		const int BENCH_DEPTH = 64;
+		U         value;
+		
+		testLogger.logEvent("Clearing the queue before benchmarking.", INFO);
+		testQueue.Clear();
+		RingQueue<U> ringQueue;
+		
+		steady_clock::time_point start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Enqueue(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Dequeue();
+		}
+		steady_clock::time_point end = steady_clock::now();
+		long long nodeBulk = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			ringQueue.Enqueue(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			ringQueue.Dequeue();
+		}
+		end = steady_clock::now();
+		long long ringBulk = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Enqueue(value);
+			if (testQueue.Size() > BENCH_DEPTH)
+			{
+				testQueue.Dequeue();
+			}
+		}
+		end = steady_clock::now();
+		long long nodeStream = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			ringQueue.Enqueue(value);
+			if (ringQueue.Size() > BENCH_DEPTH)
+			{
+				ringQueue.Dequeue();
+			}
+		}
+		end = steady_clock::now();
+		long long ringStream = duration_cast<milliseconds>(end - start).count();
+		
+		std::cout << "     Node Queue: " << std::endl;
+		std::cout << "                Bulk time = " << nodeBulk;
+		std::cout << " ms." << std::endl;
+		std::cout << "                Stream time = " << nodeStream;
+		std::cout << " ms." << std::endl;
+		std::cout << "     Ring Queue: " << std::endl;
+		std::cout << "                Bulk time = " << ringBulk;
+		std::cout << " ms." << std::endl;
+		std::cout << "                Stream time = " << ringStream;
+		std::cout << " ms." << std::endl << std::endl;
+		
+		if (testQueue.Size() == BENCH_DEPTH && ringQueue.Size() == BENCH_DEPTH)
+		{
+			testLogger.logEvent("Both queues held the expected depth.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("A queue held the wrong depth.", FAIL);
+			status = FAIL;
+		}
+		testQueue.Clear();
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the ring queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Ring Queue Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Ring Queue Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Ring Queue Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkSPSCQueue.
+//
+//	DESCRIPTION: Pass 1,000,000 items from a producer thread to a consumer 
+//				 thread, each pinned to its own core, through the SPSC queue
+//				 one at a time, through the SPSC queue in batches of 64, and
+//				 through a linked queue guarded by a mutex, and display the
+//				 time taken by each.  Then bounce one item back and forth 
+//				 20,000 times over a pair of SPSC queues and display the 
+//				 average round trip.  Every item must arrive in order.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::benchmarkSPSCQueue()
+{
+	testLogger.logEvent("***** Begin SPSC Queue Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int BENCH_SIZE  = 1000000;
+		const int BATCH_SIZE  = 64;
+		const int ROUND_TRIPS = 20000;
+		
+		SPSCQueue<U>     spscQueue(1024);
+		std::atomic<int> outOfOrder(0);
+		
+		// Single item transfer.
+		steady_clock::time_point start = steady_clock::now();
+		std::thread consumer([&]()
+		{
+			WinUtils::pinCurrentThread(1);
+			U out;
+			for (int i = 0; i < BENCH_SIZE; i++)
+			{
+				while (!spscQueue.TryDequeue(out))
+				{
+					std::this_thread::yield();
+				}
+				if (out != U(i))
+				{
+					outOfOrder.fetch_add(1);
+				}
+			}
+		});
+		std::thread producer([&]()
+		{
+			WinUtils::pinCurrentThread(0);
+			for (int i = 0; i < BENCH_SIZE; i++)
+			{
+				while (!spscQueue.TryEnqueue(U(i)))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+		producer.join();
+		consumer.join();
+		steady_clock::time_point end = steady_clock::now();
+		long long singleTime = duration_cast<milliseconds>(end - start).count();
+		
+		// Batched transfer.
+		start = steady_clock::now();
+		consumer = std::thread([&]()
+		{
+			WinUtils::pinCurrentThread(1);
+			U   out[BATCH_SIZE];
+			int received = 0;
+			while (received < BENCH_SIZE)
+			{
+				int moved = spscQueue.DequeueBatch(out, BATCH_SIZE);
+				if (moved == 0)
+				{
+					std::this_thread::yield();
+				}
+				for (int i = 0; i < moved; i++)
+				{
+					if (out[i] != U(received + i))
+					{
+						outOfOrder.fetch_add(1);
+					}
+				}
+				received = received + moved;
+			}
+		});
+		producer = std::thread([&]()
+		{
+			WinUtils::pinCurrentThread(0);
+			U   batch[BATCH_SIZE];
+			int sent = 0;
+			while (sent < BENCH_SIZE)
+			{
+				int numItems = BENCH_SIZE - sent;
+				if (numItems > BATCH_SIZE)
+				{
+					numItems = BATCH_SIZE;
+				}
+				for (int i = 0; i < numItems; i++)
+				{
+					batch[i] = U(sent + i);
+				}
+				
+				int added = 0;
+				while (added < numItems)
+				{
+					int step = spscQueue.EnqueueBatch(batch + added, 
+					                                  numItems - added);
+					if (step == 0)
+					{
+						std::this_thread::yield();
+					}
+					added = added + step;
+				}
+				sent = sent + numItems;
+			}
+		});
+		producer.join();
+		consumer.join();
+		end = steady_clock::now();
+		long long batchTime = duration_cast<milliseconds>(end - start).count();
+		
+		// Linked queue guarded by a mutex.
+		testLogger.logEvent("Clearing the queue before benchmarking.", INFO);
+		testQueue.Clear();
+		std::mutex queueMutex;
+		
+		start = steady_clock::now();
+		consumer = std::thread([&]()
+		{
+			WinUtils::pinCurrentThread(1);
+			U   out;
+			int received = 0;
+			while (received < BENCH_SIZE)
+			{
+				bool gotItem = false;
+				{
+					std::lock_guard<std::mutex> lock(queueMutex);
+					gotItem = testQueue.TryDequeue(out);
+				}
+				if (!gotItem)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				if (out != U(received))
+				{
+					outOfOrder.fetch_add(1);
+				}
+				received = received + 1;
+			}
+		});
+		producer = std::thread([&]()
+		{
+			WinUtils::pinCurrentThread(0);
+			for (int i = 0; i < BENCH_SIZE; i++)
+			{
+				std::lock_guard<std::mutex> lock(queueMutex);
+				testQueue.Enqueue(U(i));
+			}
+		});
+		producer.join();
+		consumer.join();
+		end = steady_clock::now();
+		long long lockedTime = duration_cast<milliseconds>(end - start).count();
+		
+		// Round trip latency.
+		SPSCQueue<U> pingQueue(16);
+		SPSCQueue<U> pongQueue(16);
+		
+		start = steady_clock::now();
+		std::thread echo([&]()
+		{
+			WinUtils::pinCurrentThread(1);
+			U value;
+			for (int i = 0; i < ROUND_TRIPS; i++)
+			{
+				while (!pingQueue.TryDequeue(value))
+				{
+					std::this_thread::yield();
+				}
+				while (!pongQueue.TryEnqueue(value))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+		WinUtils::pinCurrentThread(0);
+		for (int i = 0; i < ROUND_TRIPS; i++)
+		{
+			U value = U(i);
+			while (!pingQueue.TryEnqueue(value))
+			{
+				std::this_thread::yield();
+			}
+			while (!pongQueue.TryDequeue(value))
+			{
+				std::this_thread::yield();
+			}
+			if (value != U(i))
+			{
+				outOfOrder.fetch_add(1);
+			}
+		}
+		echo.join();
+		end = steady_clock::now();
+		long long roundTrip = duration_cast<nanoseconds>(end - start).count() /
+		                      ROUND_TRIPS;
+		
+		std::cout << "     SPSC Queue: " << std::endl;
+		std::cout << "                Single item time = " << singleTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "                Batch of " << BATCH_SIZE << " time = ";
+		std::cout << batchTime << " ms." << std::endl;
+		std::cout << "                Round trip = " << roundTrip;
+		std::cout << " ns." << std::endl;
+		std::cout << "    Mutex Queue: " << std::endl;
+		std::cout << "                Single item time = " << lockedTime;
+		std::cout << " ms." << std::endl << std::endl;
+		
+		if (outOfOrder.load() == 0 && spscQueue.IsEmpty() && 
+		    testQueue.IsEmpty())
+		{
+			testLogger.logEvent("Every item arrived in order.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("Items arrived out of order.", FAIL);
+			status = FAIL;
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the SPSC queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("SPSC Queue Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("SPSC Queue Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End SPSC Queue Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkMPMCQueue.
+//
+//	DESCRIPTION: Pass 240,000 items from 1, 2 or 4 producer threads to 1, 2
+//				 or 4 consumer threads through the MPMC queue one at a time,
+//				 through the MPMC queue in batches of 16, and through a 
+//				 linked queue guarded by a mutex, and display the time taken
+//				 by each.  Every item must be received exactly once.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::benchmarkMPMCQueue()
+{
+	testLogger.logEvent("***** Begin MPMC Queue Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int THREAD_COUNTS[] = { 1, 2, 4 };
+		const int NUM_COUNTS      = sizeof(THREAD_COUNTS) / sizeof(int);
+		
+		testLogger.logEvent("Clearing the queue before benchmarking.", INFO);
+		testQueue.Clear();
+		
+		for (int p = 0; p < NUM_COUNTS; p++)
+		{
+			for (int c = 0; c < NUM_COUNTS; c++)
+			{
+				int numProducers = THREAD_COUNTS[p];
+				int numConsumers = THREAD_COUNTS[c];
+				
+				long long singleTime = timeThreadedTransfer(numProducers, 
+				                              numConsumers, TRANSFER_SINGLE);
+				long long batchTime  = timeThreadedTransfer(numProducers, 
+				                              numConsumers, TRANSFER_BATCH);
+				long long lockedTime = timeThreadedTransfer(numProducers, 
+				                              numConsumers, TRANSFER_LOCKED);
+				
+				std::cout << "     " << numProducers << " x " << numConsumers;
+				std::cout << ": " << std::endl;
+				std::cout << "                Lock-free time = " << singleTime;
+				std::cout << " ms." << std::endl;
+				std::cout << "                    Batch time = " << batchTime;
+				std::cout << " ms." << std::endl;
+				std::cout << "                    Mutex time = " << lockedTime;
+				std::cout << " ms." << std::endl;
+				
+				if (singleTime < 0 || batchTime < 0 || lockedTime < 0)
+				{
+					testLogger.logEvent("Items were lost by a queue.", FAIL);
+					status = FAIL;
+				}
+			}
+		}
+		std::cout << std::endl;
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the MPMC queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("MPMC Queue Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("MPMC Queue Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End MPMC Queue Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: timeThreadedTransfer.
+//
+//	DESCRIPTION: Start the given number of producer and consumer threads, 
+//				 have the producers share 240,000 items between them, and 
+//				 have the consumers take items until all have been received.
+//				 Returns the time taken in milliseconds, or -1 if the sum of
+//				 the received items does not match what was sent.
+//
+//	PARAMETERS: numProducers: the number of producer threads.
+//				numConsumers: the number of consumer threads.
+//				mode: TRANSFER_SINGLE or TRANSFER_BATCH for the MPMC queue,
+//					  or TRANSFER_LOCKED for the linked queue with a mutex.
+//****************************************************************************
+template <class U>
+long long TestQueue<U>::timeThreadedTransfer(int numProducers, 
+                                             int numConsumers, int mode)
+{
+	const int TOTAL_ITEMS = 240000;
+	const int BATCH_SIZE  = 16;
+	
+	int                      perProducer = TOTAL_ITEMS / numProducers;
+	MPMCQueue<U>             mpmcQueue(1024);
+	std::mutex               queueMutex;
+	std::atomic<int>         remaining(perProducer * numProducers);
+	std::atomic<long long>   received(0);
+	std::vector<std::thread> workers;
+	
+	steady_clock::time_point start = steady_clock::now();
+	for (int c = 0; c < numConsumers; c++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			U         out[BATCH_SIZE];
+			long long sum = 0;
+			
+			while (remaining.load(std::memory_order_relaxed) > 0)
+			{
+				int moved = 0;
+				if (mode == TRANSFER_SINGLE)
+				{
+					moved = mpmcQueue.TryDequeue(out[0]) ? 1 : 0;
+				}
+				else if (mode == TRANSFER_BATCH)
+				{
+					moved = mpmcQueue.TryDequeueBatch(out, BATCH_SIZE);
+				}
+				else
+				{
+					std::lock_guard<std::mutex> lock(queueMutex);
+					moved = testQueue.TryDequeue(out[0]) ? 1 : 0;
+				}
+				
+				if (moved == 0)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				for (int i = 0; i < moved; i++)
+				{
+					sum = sum + out[i];
+				}
+				remaining.fetch_sub(moved);
+			}
+			received.fetch_add(sum);
+		}));
+	}
+	
+	for (int p = 0; p < numProducers; p++)
+	{
+		workers.push_back(std::thread([&, p]()
+		{
+			U   batch[BATCH_SIZE];
+			int first = p * perProducer;
+			int sent  = 0;
+			
+			while (sent < perProducer)
+			{
+				if (mode == TRANSFER_SINGLE)
+				{
+					mpmcQueue.Enqueue(U(first + sent));
+					sent = sent + 1;
+				}
+				else if (mode == TRANSFER_BATCH)
+				{
+					int numItems = perProducer - sent;
+					if (numItems > BATCH_SIZE)
+					{
+						numItems = BATCH_SIZE;
+					}
+					for (int i = 0; i < numItems; i++)
+					{
+						batch[i] = U(first + sent + i);
+					}
+					
+					int added = mpmcQueue.TryEnqueueBatch(batch, numItems);
+					if (added == 0)
+					{
+						std::this_thread::yield();
+					}
+					sent = sent + added;
+				}
+				else
+				{
+					std::lock_guard<std::mutex> lock(queueMutex);
+					testQueue.Enqueue(U(first + sent));
+					sent = sent + 1;
+				}
+			}
+		}));
+	}
+	
+	for (size_t w = 0; w < workers.size(); w++)
+	{
+		workers[w].join();
+	}
+	steady_clock::time_point end = steady_clock::now();
+	
+	long long count    = (long long)perProducer * numProducers;
+	long long expected = count * (count - 1) / 2;
+	if (received.load() != expected || !mpmcQueue.IsEmpty() || 
+	    !testQueue.IsEmpty())
+	{
+		return -1;
+	}
+	return duration_cast<milliseconds>(end - start).count();
+}
+
+//****************************************************************************
+//	NAME: testBlockingQueue.
+//
+//	DESCRIPTION: Check that PopFor gives up on an empty queue after its 
+//				 timeout.  Then stream 10,000 items from a producer thread 
+//				 that pushes runs of 50 to a consumer thread that pops 
+//				 batches of 32 through a queue with a capacity of 16, and 
+//				 check that every item arrives in order and no batch is 
+//				 larger than the capacity.  Finally check that Close wakes a
+//				 consumer blocked in Pop and that pushes are then refused.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testBlockingQueue()
+{
+	testLogger.logEvent("***** Begin Blocking Queue Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int STREAM_SIZE = 10000;
+		const int RUN_SIZE    = 50;
+		const int BATCH_SIZE  = 32;
+		const int CAPACITY    = 16;
+		
+		BlockingQueue<U> timedQueue;
+		U                out;
+		
+		testLogger.logEvent("Waiting 20 ms on an empty queue.", INFO);
+		steady_clock::time_point start = steady_clock::now();
+		bool gotItem = timedQueue.PopFor(out, milliseconds(20));
+		steady_clock::time_point end = steady_clock::now();
+		
+		if (gotItem || end - start < milliseconds(20))
+		{
+			testLogger.logEvent("PopFor did not wait for its timeout.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Streaming 10,000 items through a capacity of 16.", 
+		                    INFO);
+		BlockingQueue<U> boundedQueue(CAPACITY);
+		std::atomic<int> badBatches(0);
+		
+		std::thread consumer([&]()
+		{
+			U   batch[BATCH_SIZE];
+			int expected = 0;
+			int moved    = 0;
+			
+			while ((moved = boundedQueue.PopBatch(batch, BATCH_SIZE)) > 0)
+			{
+				if (moved > CAPACITY)
+				{
+					badBatches.fetch_add(1);
+				}
+				for (int i = 0; i < moved; i++)
+				{
+					if (batch[i] != U(expected))
+					{
+						badBatches.fetch_add(1);
+					}
+					expected = expected + 1;
+				}
+			}
+			
+			if (expected != STREAM_SIZE)
+			{
+				badBatches.fetch_add(1);
+			}
+		});
+		
+		U run[RUN_SIZE];
+		for (int sent = 0; sent < STREAM_SIZE; sent = sent + RUN_SIZE)
+		{
+			for (int i = 0; i < RUN_SIZE; i++)
+			{
+				run[i] = U(sent + i);
+			}
+			boundedQueue.PushRange(run, RUN_SIZE);
+		}
+		boundedQueue.Close();
+		consumer.join();
+		
+		if (badBatches.load() != 0)
+		{
+			testLogger.logEvent("Streamed items were lost or reordered.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Closing a queue with a blocked consumer.", INFO);
+		BlockingQueue<U>  closingQueue;
+		std::atomic<bool> popResult(true);
+		
+		std::thread waiter([&]()
+		{
+			U item;
+			popResult.store(closingQueue.Pop(item));
+		});
+		std::this_thread::sleep_for(milliseconds(10));
+		closingQueue.Close();
+		waiter.join();
+		
+		if (popResult.load() || closingQueue.Push(U(1)))
+		{
+			testLogger.logEvent("Closed queue kept accepting work.", FAIL);
+			status = FAIL;
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("Blocking queue waited and woke correctly.", 
+			                    OK);
+		}
+		else
+		{
+			testLogger.logEvent("Blocking queue misbehaved.", FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the blocking queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Blocking Queue Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Blocking Queue Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Blocking Queue Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testWorkStealingDeque.
+//
+//	DESCRIPTION: Have the owner of a work stealing deque push 100,000 items,
+//				 taking one back after every second push, while 3 thief 
+//				 threads steal from the top.  Every item must be received 
+//				 exactly once, by either the owner or a thief.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testWorkStealingDeque()
+{
+	testLogger.logEvent("***** Begin Work Stealing Deque Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int NUM_ITEMS   = 100000;
+		const int NUM_THIEVES = 3;
+		
+		WorkStealingDeque<int>   deque;
+		std::atomic<bool>        ownerDone(false);
+		std::atomic<long long>   stolenSum(0);
+		std::atomic<int>         stolenCount(0);
+		std::vector<std::thread> thieves;
+		
+		testLogger.logEvent("Pushing 100,000 items while 3 thieves steal.", 
+		                    INFO);
+		for (int t = 0; t < NUM_THIEVES; t++)
+		{
+			thieves.push_back(std::thread([&]()
+			{
+				long long sum   = 0;
+				int       count = 0;
+				int       item  = 0;
+				
+				while (!ownerDone.load() || !deque.IsEmpty())
+				{
+					if (deque.Steal(item))
+					{
+						sum = sum + item;
+						count = count + 1;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+				stolenSum.fetch_add(sum);
+				stolenCount.fetch_add(count);
+			}));
+		}
+		
+		long long takenSum   = 0;
+		int       takenCount = 0;
+		int       item       = 0;
+		for (int i = 1; i <= NUM_ITEMS; i++)
+		{
+			deque.Push(i);
+			if (i % 2 == 0 && deque.Take(item))
+			{
+				takenSum = takenSum + item;
+				takenCount = takenCount + 1;
+			}
+		}
+		while (deque.Take(item))
+		{
+			takenSum = takenSum + item;
+			takenCount = takenCount + 1;
+		}
+		ownerDone.store(true);
+		
+		for (int t = 0; t < NUM_THIEVES; t++)
+		{
+			thieves[t].join();
+		}
+		
+		long long expected = (long long)NUM_ITEMS * (NUM_ITEMS + 1) / 2;
+		if (takenSum + stolenSum.load() != expected || 
+		    takenCount + stolenCount.load() != NUM_ITEMS)
+		{
+			testLogger.logEvent("Items were lost or received twice.", FAIL);
+			status = FAIL;
+		}
+		else
+		{
+			testLogger.logEvent("Every item was received exactly once.", OK);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the work stealing deque.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Work Stealing Deque Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Work Stealing Deque Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Work Stealing Deque Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkForkJoin.
+//
+//	DESCRIPTION: Compute the 32nd Fibonacci number by naive recursion and 
+//				 build a balanced tree of 2,000,000 nodes by recursive 
+//				 halving, first on one thread and then on fork join pools of
+//				 1, 2 and 4 workers, and display the time taken by each.  
+//				 The pool must produce the same results.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::benchmarkForkJoin()
+{
+	testLogger.logEvent("***** Begin Fork Join Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int FIB_N           = 32;
+		const int TREE_NODES      = 2000000;
+		const int THREAD_COUNTS[] = { 1, 2, 4 };
+		const int NUM_COUNTS      = sizeof(THREAD_COUNTS) / sizeof(int);
+		
+		steady_clock::time_point start = steady_clock::now();
+		long long fibResult = fibSerial(FIB_N);
+		steady_clock::time_point end = steady_clock::now();
+		long long fibTime = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		ForkJoinNode* root = buildTreeSerial(0, TREE_NODES);
+		end = steady_clock::now();
+		long long treeTime = duration_cast<milliseconds>(end - start).count();
+		long long treeSum = sumTree(root);
+		freeTree(root);
+		
+		std::cout << "     Serial: " << std::endl;
+		std::cout << "                Fibonacci time = " << fibTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "                Tree build time = " << treeTime;
+		std::cout << " ms." << std::endl;
+		
+		for (int t = 0; t < NUM_COUNTS; t++)
+		{
+			ForkJoinPool pool(THREAD_COUNTS[t]);
+			long long    parallelFib = 0;
+			
+			ForkJoinTask fibTask([&]()
+			{
+				parallelFib = fibParallel(pool, FIB_N);
+			});
+			start = steady_clock::now();
+			pool.Invoke(&fibTask);
+			end = steady_clock::now();
+			fibTime = duration_cast<milliseconds>(end - start).count();
+			
+			ForkJoinTask treeTask([&]()
+			{
+				root = buildTreeParallel(pool, 0, TREE_NODES);
+			});
+			start = steady_clock::now();
+			pool.Invoke(&treeTask);
+			end = steady_clock::now();
+			treeTime = duration_cast<milliseconds>(end - start).count();
+			
+			if (parallelFib != fibResult || sumTree(root) != treeSum)
+			{
+				testLogger.logEvent("Pool produced a different result.", FAIL);
+				status = FAIL;
+			}
+			freeTree(root);
+			
+			std::cout << "     " << THREAD_COUNTS[t] << " worker(s): ";
+			std::cout << std::endl;
+			std::cout << "                Fibonacci time = " << fibTime;
+			std::cout << " ms." << std::endl;
+			std::cout << "                Tree build time = " << treeTime;
+			std::cout << " ms." << std::endl;
+		}
+		std::cout << std::endl;
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the fork join pool.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Fork Join Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Fork Join Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Fork Join Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: fibSerial.
+//
+//	DESCRIPTION: Returns the nth Fibonacci number by naive recursion.
+//
+//	PARAMETERS: n: the index of the Fibonacci number.
+//****************************************************************************
+template <class U>
+long long TestQueue<U>::fibSerial(int n)
+{
+	if (n < 2)
+	{
+		return n;
+	}
+	return fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+//****************************************************************************
+//	NAME: fibParallel.
+//
+//	DESCRIPTION: Returns the nth Fibonacci number by naive recursion, 
+//				 spawning the n - 1 branch as a task until the branches are
+//				 small enough to finish serially.
+//
+//	PARAMETERS: pool: the pool to spawn tasks on.
+//				n: the index of the Fibonacci number.
+//****************************************************************************
+template <class U>
+long long TestQueue<U>::fibParallel(ForkJoinPool& pool, int n)
+{
+	if (n < FORK_JOIN_FIB_CUTOFF)
+	{
+		return fibSerial(n);
+	}
+	
+	long long    left = 0;
+	ForkJoinTask leftTask([&]()
+	{
+		left = fibParallel(pool, n - 1);
+	});
+	
+	pool.Spawn(&leftTask);
+	long long right = fibParallel(pool, n - 2);
+	pool.Sync(&leftTask);
+	
+	return left + right;
+}
+
+//****************************************************************************
+//	NAME: buildTreeSerial.
+//
+//	DESCRIPTION: Builds a balanced binary search tree holding the values 
+//				 first to last - 1 and returns its root.
+//
+//	PARAMETERS: first: the smallest value in the tree.
+//				last: one past the largest value in the tree.
+//****************************************************************************
+template <class U>
+ForkJoinNode* TestQueue<U>::buildTreeSerial(int first, int last)
+{
+	if (first >= last)
+	{
+		return NULL;
+	}
+	
+	int           middle = first + (last - first) / 2;
+	ForkJoinNode* node   = new ForkJoinNode;
+	
+	node->value = middle;
+	node->left  = buildTreeSerial(first, middle);
+	node->right = buildTreeSerial(middle + 1, last);
+	return node;
+}
+
+//****************************************************************************
+//	NAME: buildTreeParallel.
+//
+//	DESCRIPTION: Builds the same tree as buildTreeSerial, spawning the left
+//				 subtree as a task until the ranges are small enough to 
+//				 finish serially.
+//
+//	PARAMETERS: pool: the pool to spawn tasks on.
+//				first: the smallest value in the tree.
+//				last: one past the largest value in the tree.
+//****************************************************************************
+template <class U>
+ForkJoinNode* TestQueue<U>::buildTreeParallel(ForkJoinPool& pool, int first, 
+                                              int last)
+{
+	if (last - first < FORK_JOIN_TREE_CUTOFF)
+	{
+		return buildTreeSerial(first, last);
+	}
+	
+	int           middle = first + (last - first) / 2;
+	ForkJoinNode* node   = new ForkJoinNode;
+	ForkJoinTask  leftTask([&]()
+	{
+		node->left = buildTreeParallel(pool, first, middle);
+	});
+	
+	node->value = middle;
+	pool.Spawn(&leftTask);
+	node->right = buildTreeParallel(pool, middle + 1, last);
+	pool.Sync(&leftTask);
+	return node;
+}
+
+//****************************************************************************
+//	NAME: sumTree.
+//
+//	DESCRIPTION: Returns the sum of the values in a tree.
+//
+//	PARAMETERS: node: the root of the tree.
+//****************************************************************************
+template <class U>
+long long TestQueue<U>::sumTree(ForkJoinNode* node)
+{
+	if (node == NULL)
+	{
+		return 0;
+	}
+	return node->value + sumTree(node->left) + sumTree(node->right);
+}
+
+//****************************************************************************
+//	NAME: freeTree.
+//
+//	DESCRIPTION: Deallocates every node of a tree.
+//
+//	PARAMETERS: node: the root of the tree.
+//****************************************************************************
+template <class U>
+void TestQueue<U>::freeTree(ForkJoinNode* node)
+{
+	if (node == NULL)
+	{
+		return;
+	}
+	freeTree(node->left);
+	freeTree(node->right);
+	delete node;
+}
+
+//****************************************************************************
+//	NAME: testDeque.
+//
+//	DESCRIPTION: Compute the maximum of every window of 7 over 1,000 
+//				 pseudo-random values with a deque of indices, and check it
+//				 against a direct scan of each window.  Then hold a 
+//				 reference to an item, push 10,000 items at each end, and 
+//				 check that the reference still reaches the same item.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testDeque()
+{
+	testLogger.logEvent("***** Begin Deque Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int NUM_VALUES  = 1000;
+		const int WINDOW_SIZE = 7;
+		
+		U          values[NUM_VALUES];
+		Deque<int> window;
+		unsigned   seed = 12345;
+		
+		for (int i = 0; i < NUM_VALUES; i++)
+		{
+			seed = seed * 1103515245u + 12345u;
+			values[i] = U((seed >> 16) % 1000);
+		}
+		
+		testLogger.logEvent("Sliding a window of 7 over 1,000 values.", INFO);
+		for (int i = 0; i < NUM_VALUES; i++)
+		{
+			// Drop indices that left the window, then indices whose 
+			// values can never be the maximum again.
+			if (!window.IsEmpty() && window.Front() <= i - WINDOW_SIZE)
+			{
+				window.PopFront();
+			}
+			while (!window.IsEmpty() && values[window.Back()] <= values[i])
+			{
+				window.PopBack();
+			}
+			window.PushBack(i);
+			
+			if (i >= WINDOW_SIZE - 1)
+			{
+				U expected = values[i];
+				for (int j = i - WINDOW_SIZE + 1; j < i; j++)
+				{
+					if (values[j] > expected)
+					{
+						expected = values[j];
+					}
+				}
+				if (values[window.Front()] != expected)
+				{
+					status = FAIL;
+				}
+			}
+		}
+		
+		if (status != OK)
+		{
+			testLogger.logEvent("A window maximum was wrong.", FAIL);
+		}
+		
+		testLogger.logEvent("Pushing 10,000 items at each end.", INFO);
+		Deque<U> deque;
+		deque.PushBack(U(42));
+		U* held = &deque[0];
+		
+		for (int i = 0; i < 10000; i++)
+		{
+			deque.PushFront(U(i));
+			deque.PushBack(U(i));
+		}
+		
+		if (held != &deque[10000] || *held != U(42) || deque.Size() != 20001)
+		{
+			testLogger.logEvent("Reference moved after end insertions.", FAIL);
+			status = FAIL;
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("Deque windows and references were correct.", 
+			                    OK);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the deque.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Deque Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Deque Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Deque Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkDeque.
+//
+//	DESCRIPTION: Pass 1,000,000 items first in first out through the linked
+//				 queue, the ring queue and the deque, then push and pop 
+//				 1,000,000 items last in first out at the back of the deque,
+//				 and display the time taken by each.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::benchmarkDeque()
+{
+	testLogger.logEvent("***** Begin Deque Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int BENCH_SIZE = 1000000;
+		U         value;
+		
+		testLogger.logEvent("Clearing the queue before benchmarking.", INFO);
+		testQueue.Clear();
+		RingQueue<U> ringQueue;
+		Deque<U>     deque;
+		
+		steady_clock::time_point start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Enqueue(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Dequeue();
+		}
+		steady_clock::time_point end = steady_clock::now();
+		long long nodeTime = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			ringQueue.Enqueue(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			ringQueue.Dequeue();
+		}
+		end = steady_clock::now();
+		long long ringTime = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			deque.PushBack(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			deque.PopFront();
+		}
+		end = steady_clock::now();
+		long long fifoTime = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			deque.PushBack(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			deque.PopBack();
+		}
+		end = steady_clock::now();
+		long long lifoTime = duration_cast<milliseconds>(end - start).count();
+		
+		std::cout << "     Node Queue: " << std::endl;
+		std::cout << "                FIFO time = " << nodeTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "     Ring Queue: " << std::endl;
+		std::cout << "                FIFO time = " << ringTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "          Deque: " << std::endl;
+		std::cout << "                FIFO time = " << fifoTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "                LIFO time = " << lifoTime;
+		std::cout << " ms." << std::endl << std::endl;
+		
+		if (testQueue.IsEmpty() && ringQueue.IsEmpty() && deque.IsEmpty())
+		{
+			testLogger.logEvent("All containers were drained.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("A container was not drained.", FAIL);
+			status = FAIL;
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the deque.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Deque Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Deque Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Deque Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testSpillQueue.
+//
+//	DESCRIPTION: Enqueue 5,000 items into a spill queue that keeps 64 items
+//				 in memory at each end and stores 256 items per segment, 
+//				 dequeue the first 100, checkpoint it, and close it.  Then 
+//				 reopen the queue from its files and check that the other 
+//				 4,900 items come back in order.  Last, keep dequeueing 
+//				 and enqueueing on a queue whose reader has caught up to 
+//				 the segment still being written, and check that every 
+//				 item comes back in order.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::testSpillQueue()
+{
+	testLogger.logEvent("***** Begin Spill Queue Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const std::string PREFIX = "spillQueueTest";
+		U out;
+		
+		{
+			SpillQueue<U> spillQueue(PREFIX, 64, 256);
+			spillQueue.Purge();
+			
+			testLogger.logEvent("Enqueueing 5,000 items.", INFO);
+			for (int i = 0; i < 5000; i++)
+			{
+				spillQueue.Enqueue(U(i));
+			}
+			
+			if (spillQueue.SpilledCount() == 0)
+			{
+				testLogger.logEvent("Nothing was spilled to disk.", FAIL);
+				status = FAIL;
+			}
+			
+			testLogger.logEvent("Dequeueing 100 items and checkpointing.", 
+			                    INFO);
+			for (int i = 0; i < 100; i++)
+			{
+				if (!spillQueue.TryDequeue(out) || out != U(i))
+				{
+					status = FAIL;
+				}
+			}
+			
+			if (!spillQueue.Checkpoint())
+			{
+				testLogger.logEvent("Checkpoint failed.", FAIL);
+				status = FAIL;
+			}
+		}
+		
+		testLogger.logEvent("Reopening the queue from its files.", INFO);
+		SpillQueue<U> recovered(PREFIX, 64, 256);
+		
+		if (recovered.Size() != 4900)
+		{
+			testLogger.logEvent("Recovered queue has the wrong size.", FAIL);
+			status = FAIL;
+		}
+		
+		for (int i = 100; i < 5000; i++)
+		{
+			if (!recovered.TryDequeue(out) || out != U(i))
+			{
+				status = FAIL;
+				break;
+			}
+		}
+		recovered.Purge();
+		
+		testLogger.logEvent("Reading the segment that is being written.", 
+		                    INFO);
+		{
+			SpillQueue<U> sharedQueue(PREFIX, 64, 4096);
+			int next     = 0;
+			int expected = 0;
+			
+			sharedQueue.Purge();
+			for (; next < 1000; next++)
+			{
+				sharedQueue.Enqueue(U(next));
+			}
+			
+			// Every item fits in segment 0, so the reader maps the same 
+			// file the writer still has open and keeps appending to.
+			for (int round = 0; round < 4 && status == OK; round++)
+			{
+				if (sharedQueue.SpilledCount() == 0)
+				{
+					testLogger.logEvent("Nothing was spilled to disk.", FAIL);
+					status = FAIL;
+				}
+				
+				for (int i = 0; i < 500; i++, expected++)
+				{
+					if (!sharedQueue.TryDequeue(out) || out != U(expected))
+					{
+						status = FAIL;
+					}
+				}
+				for (int i = 0; i < 500; i++, next++)
+				{
+					sharedQueue.Enqueue(U(next));
+				}
+			}
+			
+			while (sharedQueue.TryDequeue(out))
+			{
+				if (out != U(expected))
+				{
+					status = FAIL;
+				}
+				expected = expected + 1;
+			}
+			
+			if (expected != next)
+			{
+				testLogger.logEvent("The shared segment stalled the queue.", 
+				                    FAIL);
+				status = FAIL;
+			}
+			sharedQueue.Purge();
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("Every spilled item was recovered in order.", 
+			                    OK);
+		}
+		else
+		{
+			testLogger.logEvent("Spilled items were lost or reordered.", FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the spill queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Spill Queue Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Spill Queue Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Spill Queue Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkSpillQueue.
+//
+//	DESCRIPTION: Build a backlog of 8,000,000 items in the linked queue and
+//				 in a spill queue that keeps 65,536 items in memory at each 
+//				 end, then drain both, and display the time taken and the 
+//				 throughput of each.  Then stream 8,000,000 more items 
+//				 through the spill queue while it holds a backlog of 
+//				 4,000,000, which keeps it reading and writing segments the 
+//				 whole time.  
+//****************************************************************************
+template <class U>
+bool TestQueue<U>::benchmarkSpillQueue()
+{
+	testLogger.logEvent("***** Begin Spill Queue Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int       BENCH_SIZE = 8000000;
+		const int       BACKLOG    = 4000000;
+		const double    MEGABYTES  = (double)BENCH_SIZE * sizeof(U) / 1048576.0;
+		U               value      = U();
+		
+		testLogger.logEvent("Clearing the queue before benchmarking.", INFO);
+		testQueue.Clear();
+		
+		steady_clock::time_point start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Enqueue(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testQueue.Dequeue();
+		}
+		steady_clock::time_point end = steady_clock::now();
+		long long nodeTime = duration_cast<milliseconds>(end - start).count();
+		
+		SpillQueue<U> benchQueue("spillQueueBench");
+		long long     received = 0;
+		benchQueue.Purge();
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			benchQueue.Enqueue(value);
+		}
+		while (benchQueue.TryDequeue(value))
+		{
+			received = received + 1;
+		}
+		end = steady_clock::now();
+		long long spillTime = duration_cast<milliseconds>(end - start).count();
+		
+		for (int i = 0; i < BACKLOG; i++)
+		{
+			benchQueue.Enqueue(value);
+		}
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			benchQueue.Enqueue(value);
+			benchQueue.Dequeue();
+		}
+		end = steady_clock::now();
+		long long streamTime = duration_cast<milliseconds>(end - start).count();
+		
+		if (received != BENCH_SIZE || benchQueue.Size() != BACKLOG)
+		{
+			testLogger.logEvent("Spill queue lost items.", FAIL);
+			status = FAIL;
+		}
+		benchQueue.Purge();
+		
+		std::cout << "     Node Queue: " << std::endl;
+		std::cout << "                Backlog time = " << nodeTime;
+		std::cout << " ms (" << (long long)(MEGABYTES * 1000.0 / 
+		                       (nodeTime + 1)) << " MB/s)." << std::endl;
+		std::cout << "    Spill Queue: " << std::endl;
+		std::cout << "                Backlog time = " << spillTime;
+		std::cout << " ms (" << (long long)(MEGABYTES * 1000.0 / 
+		                       (spillTime + 1)) << " MB/s)." << std::endl;
+		std::cout << "                Stream time = " << streamTime;
+		std::cout << " ms (" << (long long)(MEGABYTES * 1000.0 / 
+		                       (streamTime + 1)) << " MB/s)." << std::endl;
+		std::cout << std::endl;
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the spill queue.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Spill Queue Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Spill Queue Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Spill Queue Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
@@ -8,7 +8,32 @@
 #define _TESTQUEUE_H
 
 #include "Queue.h"
+#include "RingQueue.h"
+#include "Deque.h"
+#include "SpillQueue.h"
+#include "SPSCQueue.h"
+#include "MPMCQueue.h"
+#include "BlockingQueue.h"
+#include "WorkStealingDeque.h"
+#include "ForkJoinPool.h"
 #include "Logger.h"
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+using namespace std::chrono;
+
+// Below these sizes the fork join benchmarks recurse serially.
+#define FORK_JOIN_FIB_CUTOFF  16
+#define FORK_JOIN_TREE_CUTOFF 4096
+
+// Node of the tree built by the fork join benchmark.
+struct ForkJoinNode
+{
+	ForkJoinNode* left;
+	ForkJoinNode* right;
+	int           value;
+};
 
 template <class U>
 class TestQueue
@@ -31,10 +56,37 @@ public:
 	bool testEmptyQueueSearch();
 	bool testNotFoundSearch();
 	bool testSearch();
+	
+	bool testTryDequeue();
+	bool testBatchOperations();
+	bool testRingQueue();
+	bool testBlockingQueue();
+	bool benchmarkRingQueue();
+	bool testDeque();
+	bool benchmarkDeque();
+	bool testSpillQueue();
+	bool benchmarkSpillQueue();
+	bool benchmarkSPSCQueue();
+	bool benchmarkMPMCQueue();
+	bool testWorkStealingDeque();
+	bool benchmarkForkJoin();
 
 private:
+	enum TransferMode { TRANSFER_SINGLE, TRANSFER_BATCH, TRANSFER_LOCKED };
+	
 	Queue<U> testQueue;  
 	Logger testLogger;
+	
+	long long timeThreadedTransfer(int numProducers, int numConsumers, 
+	                               int mode);
+	
+	static long long fibSerial(int n);
+	static long long fibParallel(ForkJoinPool& pool, int n);
+	static ForkJoinNode* buildTreeSerial(int first, int last);
+	static ForkJoinNode* buildTreeParallel(ForkJoinPool& pool, int first, 
+	                                       int last);
+	static long long sumTree(ForkJoinNode* node);
+	static void freeTree(ForkJoinNode* node);
 };
 
 #endif 
@@ -147,6 +147,30 @@ void WinUtils::printOSDetails()
 #endif
 }
 
+//****************************************************************************
+//	NAME: pinCurrentThread.
+//
+//	DESCRIPTION: Restricts the calling thread to run on the given core so 
+//				 that benchmarks between threads are not disturbed by the
+//				 scheduler moving them.  Returns false if the core does not
+//				 exist or the platform does not support pinning.
+//****************************************************************************
+bool WinUtils::pinCurrentThread(int core)
+{
+#ifdef _WIN32
+	DWORD_PTR affinity = (DWORD_PTR)1 << core;
+	return (SetThreadAffinityMask(GetCurrentThread(), affinity) != 0);
+#elif defined(__linux__)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(core, &cpuSet);
+	return (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), 
+	                               &cpuSet) == 0);
+#else
+	return false;
+#endif
+}
+
 //****************************************************************************
 //	NAME: printUIBanner.
 //
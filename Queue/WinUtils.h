@@ -18,6 +18,12 @@
 #include <unistd.h>
 #endif
 
+// Needed for pinning threads to a core
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #define OK 1
 #define FAIL 0
 #define INFO 2
@@ -47,6 +53,7 @@ namespace WinUtils
 	
 	void printHardwareDetails();
 	void printOSDetails();
+	bool pinCurrentThread(int core);
 	
 	void printUIBanner();	
 	void printInvalidUIBanner();
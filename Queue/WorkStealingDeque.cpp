@@ -0,0 +1,9 @@
+//***************************************************************************
+//	Implementation File for Templated Work Stealing Deque
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "WorkStealingDeque.h"
+
+template class WorkStealingDeque<int>;
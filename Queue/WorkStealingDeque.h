@@ -0,0 +1,267 @@
+//***************************************************************************
+//	Header File for Templated Work Stealing Deque
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _WORKSTEALINGDEQUE_H
+#define _WORKSTEALINGDEQUE_H
+
+#include <iostream>
+#include <atomic>
+using namespace std;
+
+// Number of slots in a new deque's ring.
+#define WSDEQUE_MIN_CAPACITY 256
+
+template<class T>
+class WorkStealingDeque;
+
+template<class T>
+class WSDequeArray
+{
+	long long          capacity;
+	long long          mask;
+	std::atomic<T>*    slots;
+	WSDequeArray*      previous;
+	
+	WSDequeArray(long long newCapacity)
+		: capacity(newCapacity), mask(newCapacity - 1), 
+		  slots(new std::atomic<T>[newCapacity]), previous(NULL){}
+	~WSDequeArray() { delete[] slots; }
+	
+	T Get(long long index) const
+	{
+		return slots[index & mask].load(std::memory_order_relaxed);
+	}
+	void Put(long long index, T item)
+	{
+		slots[index & mask].store(item, std::memory_order_relaxed);
+	}
+
+	friend class WorkStealingDeque<T>;
+};
+
+//***************************************************************************
+//	Chase-Lev work stealing deque.  One thread, the owner, pushes and takes
+//	items at the bottom like a stack; any number of other threads steal 
+//	items from the top.  The owner and the thieves only contend for the 
+//	last item, which is settled with a compare-exchange on top.
+//
+//	The ring grows when the owner pushes onto a full deque.  A thief may 
+//	still be reading the old ring, so old rings are kept until the deque is
+//	destroyed.  T must be trivially copyable; the deque is meant to hold 
+//	pointers to tasks.
+//***************************************************************************
+template<class T>
+class WorkStealingDeque
+{
+public:
+	WorkStealingDeque();
+	
+	void Push(T item);
+	bool Take(T& out);
+	bool Steal(T& out);
+	
+	bool IsEmpty() const;
+	int Size() const;
+
+	WorkStealingDeque(const WorkStealingDeque&) = delete;
+	WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+	~WorkStealingDeque();
+
+private:
+	std::atomic<long long>        top;
+	std::atomic<long long>        bottom;
+	std::atomic<WSDequeArray<T>*> array;
+	
+	WSDequeArray<T>* Grow(WSDequeArray<T>* oldArray, long long first, 
+	                      long long last);
+};
+
+// The methods are defined here rather than in WorkStealingDeque.cpp so that
+// ForkJoinPool can instantiate the deque for its own task type.
+
+//***************************************************************************
+//		Constructor.
+//***************************************************************************
+template<class T>
+WorkStealingDeque<T>::WorkStealingDeque()
+	: top(0), bottom(0), array(NULL)
+{
+	array.store(new WSDequeArray<T>(WSDEQUE_MIN_CAPACITY), 
+	            std::memory_order_relaxed);
+}
+
+//***************************************************************************
+//		Owner method to push an item onto the bottom of the deque, growing 
+//	the ring first if it is full.  Only the owning thread may call this.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T>
+void WorkStealingDeque<T>::Push(T item)
+{
+	long long        b = bottom.load(std::memory_order_relaxed);
+	long long        t = top.load(std::memory_order_acquire);
+	WSDequeArray<T>* a = array.load(std::memory_order_relaxed);
+	
+	if (b - t > a->capacity - 1)
+	{
+		a = Grow(a, t, b);
+	}
+	
+	a->Put(b, item);
+	bottom.store(b + 1, std::memory_order_release);
+}
+
+//***************************************************************************
+//		Owner method to take the item most recently pushed.  Returns false,
+//	leaving out untouched, if the deque is empty or a thief won the last 
+//	item.  Only the owning thread may call this.
+//
+//	Parameters:
+//		out: receives the element from the bottom of the deque.
+//***************************************************************************
+template<class T>
+bool WorkStealingDeque<T>::Take(T& out)
+{
+	long long        b = bottom.load(std::memory_order_relaxed) - 1;
+	WSDequeArray<T>* a = array.load(std::memory_order_relaxed);
+	
+	// Claim the bottom slot before looking at top, so a thief that reads
+	// the old bottom and this take cannot both see the same item as free.
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	long long t = top.load(std::memory_order_relaxed);
+	
+	if (t > b)
+	{
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return false;
+	}
+	
+	T item = a->Get(b);
+	if (t == b)
+	{
+		// Last item: race the thieves for it.
+		bool won = top.compare_exchange_strong(t, t + 1, 
+		                                       std::memory_order_seq_cst, 
+		                                       std::memory_order_relaxed);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		if (!won)
+		{
+			return false;
+		}
+	}
+	
+	out = item;
+	return true;
+}
+
+//***************************************************************************
+//		Thief method to steal the oldest item in the deque.  Returns false,
+//	leaving out untouched, if the deque is empty or another thread took the
+//	item first.  Any thread may call this.
+//
+//	Parameters:
+//		out: receives the element from the top of the deque.
+//***************************************************************************
+template<class T>
+bool WorkStealingDeque<T>::Steal(T& out)
+{
+	long long t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	long long b = bottom.load(std::memory_order_acquire);
+	
+	if (t >= b)
+	{
+		return false;
+	}
+	
+	WSDequeArray<T>* a    = array.load(std::memory_order_acquire);
+	T                item = a->Get(t);
+	
+	if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, 
+	                                 std::memory_order_relaxed))
+	{
+		return false;
+	}
+	
+	out = item;
+	return true;
+}
+
+//***************************************************************************
+//		Method to return true if the deque held no items at the moment it 
+//	was checked.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+bool WorkStealingDeque<T>::IsEmpty() const
+{
+	return (Size() == 0);
+}
+
+//***************************************************************************
+//		Method to return the number of items in the deque.  While other 
+//	threads are running the value is only a snapshot.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+int WorkStealingDeque<T>::Size() const
+{
+	long long t = top.load(std::memory_order_acquire);
+	long long b = bottom.load(std::memory_order_acquire);
+	
+	return (b > t) ? (int)(b - t) : 0;
+}
+
+//***************************************************************************
+//		Owner method to replace the ring with one twice the size, copying 
+//	the live items across.  The old ring is kept on a list until the deque
+//	is destroyed, since a thief may still be reading from it.
+//
+//	Parameters:
+//		oldArray: the ring in use.
+//		first: the index of the oldest item.
+//		last: one past the index of the newest item.
+//***************************************************************************
+template<class T>
+WSDequeArray<T>* WorkStealingDeque<T>::Grow(WSDequeArray<T>* oldArray, 
+                                            long long first, long long last)
+{
+	WSDequeArray<T>* newArray = new WSDequeArray<T>(oldArray->capacity * 2);
+	
+	for (long long i = first; i < last; i++)
+	{
+		newArray->Put(i, oldArray->Get(i));
+	}
+	
+	newArray->previous = oldArray;
+	array.store(newArray, std::memory_order_release);
+	return newArray;
+}
+
+//***************************************************************************
+//		Destructor.  Must only run once every thread is done with the deque.
+//***************************************************************************
+template<class T>
+WorkStealingDeque<T>::~WorkStealingDeque()
+{
+	WSDequeArray<T>* a = array.load(std::memory_order_relaxed);
+	
+	while (a != NULL)
+	{
+		WSDequeArray<T>* previous = a->previous;
+		delete a;
+		a = previous;
+	}
+}
+
+#endif
@@ -0,0 +1,70 @@
+//***************************************************************************
+//	Header File for Templated Frozen Search Tree
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _FROZENTREE_H
+#define _FROZENTREE_H
+
+#include <iostream>
+#include <string>
+#include <new>
+
+#ifdef _MSC_VER
+#include <xmmintrin.h>
+#define FROZEN_PREFETCH(address) \
+	_mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define FROZEN_PREFETCH(address) __builtin_prefetch(address)
+#endif
+
+using namespace std;
+
+// How many levels ahead a search prefetches.  Four levels down the 16
+// descendants of a slot are contiguous, so one prefetch covers all of them.
+#define FROZEN_PREFETCH_LEVELS 4
+
+// Number of queries a batch lookup walks down the array side by side.
+#define FROZEN_BATCH_SIZE 16
+
+//***************************************************************************
+//	Immutable, read only copy of a search tree.  The keys are kept in one
+//	contiguous array in Eytzinger (breadth first) order: the root is in slot
+//	1 and the children of slot k are in slots 2k and 2k + 1.  A search is a
+//	fixed number of compare-and-shift steps with no branch on the result,
+//	and the slots it will visit a few levels down are prefetched while the
+//	current level is compared.  Trees fill one with their Freeze() method.
+//***************************************************************************
+template<class T>
+class FrozenTree
+{
+public:
+	FrozenTree();
+	FrozenTree(const T* sortedKeys, int numKeys);
+	FrozenTree(const FrozenTree<T>& other);
+	FrozenTree<T>& operator=(const FrozenTree<T>& other);
+
+	bool Build(const T* sortedKeys, int numKeys);
+	void Clear();
+
+	bool Contains(const T& key) const;
+	bool LowerBound(const T& key, T& result) const;
+	int ContainsBatch(const T* keys, bool* found, int numKeys) const;
+	int LowerBoundBatch(const T* keys, T* results, bool* found,
+						int numKeys) const;
+
+	int Size() const { return count; }
+	bool IsEmpty() const { return (count == 0); }
+
+	~FrozenTree();
+
+private:
+	T* slots;
+	int count;
+
+	int Descend(const T& key) const;
+	int Fill(const T* sortedKeys, int next, int slot);
+};
+
+#endif
@@ -57,17 +57,18 @@ int main()
 //***************************************************************************
 void printMenu()
 {
-	cout << " ________________________________ " << endl;
-	cout << "| +Key  | Insert Item            |" << endl;
-	cout << "| -Key  | Remove Item            |" << endl;
-	cout << "| ?Key  | Search Item            |" << endl;
-	cout << "| R     | Prune Tree             |" << endl;	
-	cout << "| I     | Print Items In Order   |" << endl;
-	cout << "| P     | Print Items Pre Order  |" << endl;
-	cout << "| T     | Print Items Post Order |" << endl;
-	cout << "| @     | Print Cursor Value     |" << endl;
-	cout << "| D     | Delete the Tree        |" << endl;
-	cout << "|_______|________________________|" << endl << endl;
+	cout << " ________________________________________ " << endl;
+	cout << "| +Key  | Insert Item                    |" << endl;
+	cout << "| -Key  | Remove Item                    |" << endl;
+	cout << "| ?Key  | Search Item                    |" << endl;
+	cout << "| R     | Prune Tree                     |" << endl;	
+	cout << "| I     | Print Items In Order           |" << endl;
+	cout << "| P     | Print Items Pre Order          |" << endl;
+	cout << "| T     | Print Items Post Order         |" << endl;
+	cout << "| H     | Print Items Hierarchical Order |" << endl;
+	cout << "| @     | Print Cursor Value             |" << endl;
+	cout << "| D     | Delete the Tree                |" << endl;
+	cout << "|_______|________________________________|" << endl << endl;
     cout << "Please choose an operation to perform on the tree." << endl;
     cout << "Enter Q to quit." << endl;	
 }
@@ -208,6 +209,22 @@ void choose(RBTree<K, V>& myTree)
 				}
 				break;
 			}
+			case 'h': case 'H':
+			{
+				if (hasInserted)
+				{
+					cout << "The contents of the tree printed in a hierarchical order are: \n";
+					myTree.printHierarchical();
+					cout << endl << endl;
+					system("pause");
+				}
+				else
+				{
+					cerr << "\nPlease insert data into the tree." << endl;
+					system("pause");					
+				}
+				break;
+			}
 			case 'd': case 'D':
 			{
 				myTree.clearTree();
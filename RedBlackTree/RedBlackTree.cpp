@@ -328,6 +328,7 @@ bool RBTree<K, V>::searchKey(const K key)
             }
         }
     }
+    return false;
 }
 
 //***************************************************************************
@@ -757,126 +758,109 @@ void RBTree<K, V>::pruneHelper(RBNode<K, V>* subtree)
 }
 
 //***************************************************************************
-//	NAME: printTree.
+//	NAME: freeze.
 //
-//	DESCRIPTION: Method to print the tree in level order.
+//	DESCRIPTION: Method to export the keys into a read only frozen tree, 
+//	             replacing anything it held.  The values are not copied.  
+//	             If a bad allocation error is detected, a message will be 
+//	             displayed and false returned.
 //
-//	PARAMETERS:	N/A.
+//	PARAMETERS: frozen: the frozen tree to fill.
 //***************************************************************************
 template <class K, class V>
-void RBTree<K, V>::printTree()
+bool RBTree<K, V>::freeze(FrozenTree<K>& frozen) const
 {
-	if (!root)
+	vector<K> keys;
+	try
 	{
-        return;
-    }
-    else
-    {
-        int ctr = 0;
-        while (ctr <= getTreeHeight(root))
-        {
-            printLevel(ctr);
-            ctr++;
-            cout << endl << endl;
-        }
-    }
+		forEachInOrder([&](const K& key, const V&)
+		{
+			keys.push_back(key);
+			return true;
+		});
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to freeze the Red-Black Tree." << endl;
+		frozen.Clear();
+		return false;
+	}
+	
+	return frozen.Build(keys.empty() ? NULL : &keys[0], (int)keys.size());
 }
 
 //***************************************************************************
-//	NAME: getTreeHeight.
+//	NAME: printTree.
 //
-//	DESCRIPTION: Calculates the height of the tree.
+//	DESCRIPTION: Method to print the tree in level order.  The tree is 
+//	             walked once and the text is written to the stream in large
+//	             blocks, so each node's color is shown as (R) or (B) rather
+//	             than with console colors.  By default the whole tree is 
+//	             printed.  If maxDepth or maxWidth is positive, levels past
+//	             maxDepth are left out and lines are kept within maxWidth 
+//	             characters.
 //
-//	PARAMETERS:	subtree: pointer to the root of subtree.
+//	PARAMETERS:	out: the stream to print to, such as cout or an ofstream.
+//	            maxDepth: the most levels to print, or 0 for no limit.
+//	            maxWidth: the most characters on a line, or 0 for no limit.
 //***************************************************************************
 template <class K, class V>
-int RBTree<K, V>::getTreeHeight(RBNode<K, V>* subtree)
+void RBTree<K, V>::printTree(ostream& out, int maxDepth, int maxWidth) const
 {
-	if (subtree == NULL)
-	{
-		return 0;
-	}
-	else
+	TreePrinter printer(out, maxDepth, maxWidth);
+	printer.PrintLevels(root, [this](const RBNode<K, V>* subtree)
 	{
-		int leftHeight = getTreeHeight(subtree->left);
-		int rightHeight = getTreeHeight(subtree->right);
-		
-		if (leftHeight >= rightHeight)
-		{
-			return leftHeight + 1;
-		}
-		else
-		{
-			return rightHeight + 1;
-		}
-	}
+		return nodeLabel(subtree);
+	});
 }
 
 //***************************************************************************
-//	NAME: printLevel.
+//	NAME: printHierarchical.
 //
-//	DESCRIPTION: Calculates width to space out nodes and calls DispLevel to 
-//				 print nodes on given level.
+//	DESCRIPTION: Method to print the tree to resemble a file tree, with the
+//	             same limits as printTree.
 //
-//	PARAMETERS: height: height of tree.
+//	PARAMETERS:	out: the stream to print to, such as cout or an ofstream.
+//	            maxDepth: the most levels to print, or 0 for no limit.
+//	            maxWidth: the most characters on a line, or 0 for no limit.
 //***************************************************************************
 template <class K, class V>
-void RBTree<K, V>::printLevel(int height)
+void RBTree<K, V>::printHierarchical(ostream& out, int maxDepth, 
+									 int maxWidth) const
 {
-	RBNode<K, V>* temp = root;
-	
-	// leftmost point
-	int value = pow(2, getTreeHeight(root) - height + 3);
-	cout << setw(value - 4) << "";
-	dispLevel(temp, height, value);
+	TreePrinter printer(out, maxDepth, maxWidth);
+	printer.PrintHierarchical(root, [this](const RBNode<K, V>* subtree)
+	{
+		return nodeLabel(subtree);
+	});
 }
 
 //***************************************************************************
-//	NAME: dispLevel.
+//	NAME: nodeLabel.
 //
-//	DESCRIPTION: Displays the nodes on given level and will display 'x' 
-//	             where the pointers are NULL.
+//	DESCRIPTION: Helper method to return the text shown for a node by the 
+//	             printers.  The node the cursor references is shown in 
+//	             brackets, like printNodeAndColor does.
 //
-//	PARAMETERS: subtree : node to be displayed.
-//		        level   : current level.
-//		        displace: displacement.
+//	PARAMETERS: subtree: node to be displayed.
 //***************************************************************************
 template <class K, class V>
-void RBTree<K, V>::dispLevel(RBNode<K, V>* subtree, int level, int displace)
+string RBTree<K, V>::nodeLabel(const RBNode<K, V>* subtree) const
 {
-	int redColorCode   = 79;
-	int blackColorCode = 112;
-	int disp           = 2 * displace;
-	
-	if (level == 0)
+	ostringstream text;
+	if (subtree == cursor)
 	{
-		if (subtree == NULL)
-		{
-			cout << " x ";
-			cout << setw(disp + 4) << "";
-			return;
-		}
-		else
-		{
-			int result = ((subtree->data <= 1) ? 1: log10(subtree->data) - 5);
-			printNodeAndColor(subtree);
-			cout << setw(disp - result) << "";
-		}
+		text << "[";
 	}
 	
-	else
+	text << "<" << subtree->data << ", " << subtree->name << "> (" 
+		 << (subtree->color == RED ? "R" : "B") << ")";
+		 
+	if (subtree == cursor)
 	{
-		if (subtree == NULL && level >= 1)
-		{
-			dispLevel(NULL, level - 1, displace);
-			dispLevel(NULL, level - 1, displace);
-		}
-		else
-		{
-			dispLevel(subtree->left, level - 1, displace);
-			dispLevel(subtree->right, level - 1, displace);
-		}
+		text << "]";
 	}
+	return text.str();
 }
 
 //***************************************************************************
@@ -12,7 +12,11 @@
 #include <cstdlib>
 #include <cmath>
 #include <string>
+#include <sstream>
+#include <vector>
 #include <windows.h>
+#include "FrozenTree.h"
+#include "TreePrinter.h"
 using namespace std;
 
 template <class K, class V>
@@ -44,6 +48,7 @@ class RBNode
 	RBNode<K, V> *getSibling();
 	
 	friend class RBTree<K, V>;
+	friend class TreePrinter;
 };
 
 template <class K, class V>
@@ -57,12 +62,25 @@ public:
     void deleteKey(const K key); 
     void clearTree();
     
-    void printTree();
+    void printTree() { printTree(cout); }
+    void printTree(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+                   int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
+    void printHierarchical() { printHierarchical(cout); }
+    void printHierarchical(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+                           int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
     void inOrder();
     void preOrder();
     void postOrder();
+    
+    template <class Visitor>
+    bool forEachInOrder(Visitor visit) const;
+    template <class Visitor>
+    bool forEachPreOrder(Visitor visit) const;
+    template <class Visitor>
+    bool forEachPostOrder(Visitor visit) const;
 	void printCursor(); 
 	void prune() { return pruneHelper(root); };
+	bool freeze(FrozenTree<K>& frozen) const;
  
 private:
 	RBNode<K, V>* root;
@@ -86,10 +104,8 @@ private:
 	bool isLeaf(RBNode<K, V>* subtree) const { return (subtree->left == NULL && 
 												   subtree->right == NULL); }
 	
-	// Printing in Level Order Helper Methods.
-	int getTreeHeight(RBNode<K, V>* subtree); 
-	void printLevel(int treeHeight); 
-	void dispLevel(RBNode<K, V>* subtree, int level, int displace);
+	// Printing Helper Method.
+	string nodeLabel(const RBNode<K, V>* subtree) const;
 	
 	// Printing in Other Order Helper Methods.
 	void inOrderHelper(RBNode<K, V>* subtree);
@@ -99,5 +115,129 @@ private:
 	// Colored Output Method.
 	void printNodeAndColor(RBNode<K, V>* subtree) const;
 };
+//***************************************************************************
+//	NAME: forEachInOrder.
+//
+//	DESCRIPTION: Method to call visit on every key and value in order,
+//	             without printing anything.  It is defined in the header so
+//	             the callback can be any function or function object and can
+//	             be inlined into the walk.  The walk stops as soon as visit
+//	             returns false, and the method returns false if it was
+//	             stopped early.
+//
+//	PARAMETERS: visit: called with each key and value, returns false to stop.
+//***************************************************************************
+template <class K, class V>
+template <class Visitor>
+bool RBTree<K, V>::forEachInOrder(Visitor visit) const
+{
+	vector<const RBNode<K, V>*> pending;
+	const RBNode<K, V>* node = root;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		node = pending.back();
+		pending.pop_back();
+		
+		if (!visit(node->data, node->name))
+		{
+			return false;
+		}
+		node = node->right;
+	}
+	return true;
+}
+
+//***************************************************************************
+//	NAME: forEachPreOrder.
+//
+//	DESCRIPTION: Method to call visit on every key and value in pre order,
+//	             each node before its children, like forEachInOrder.
+//
+//	PARAMETERS: visit: called with each key and value, returns false to stop.
+//***************************************************************************
+template <class K, class V>
+template <class Visitor>
+bool RBTree<K, V>::forEachPreOrder(Visitor visit) const
+{
+	vector<const RBNode<K, V>*> pending;
+	
+	if (root != NULL)
+	{
+		pending.push_back(root);
+	}
+	
+	while (!pending.empty())
+	{
+		const RBNode<K, V>* node = pending.back();
+		pending.pop_back();
+		
+		if (!visit(node->data, node->name))
+		{
+			return false;
+		}
+		
+		if (node->right != NULL)
+		{
+			pending.push_back(node->right);
+		}
+		if (node->left != NULL)
+		{
+			pending.push_back(node->left);
+		}
+	}
+	return true;
+}
+
+//***************************************************************************
+//	NAME: forEachPostOrder.
+//
+//	DESCRIPTION: Method to call visit on every key and value in post
+//	             order, each node after its children, like forEachInOrder.  A
+//	             node stays on the stack until its right subtree is done,
+//	             which is known when the last node visited is its right
+//	             child.
+//
+//	PARAMETERS: visit: called with each key and value, returns false to stop.
+//***************************************************************************
+template <class K, class V>
+template <class Visitor>
+bool RBTree<K, V>::forEachPostOrder(Visitor visit) const
+{
+	vector<const RBNode<K, V>*> pending;
+	const RBNode<K, V>* node = root;
+	const RBNode<K, V>* last = NULL;
+	
+	while (node != NULL || !pending.empty())
+	{
+		while (node != NULL)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+		
+		const RBNode<K, V>* top = pending.back();
+		if (top->right != NULL && top->right != last)
+		{
+			node = top->right;
+		}
+		else
+		{
+			if (!visit(top->data, top->name))
+			{
+				return false;
+			}
+			last = top;
+			pending.pop_back();
+		}
+	}
+	return true;
+}
 
 #endif
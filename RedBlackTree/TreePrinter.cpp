@@ -0,0 +1,64 @@
+//***************************************************************************
+//	Implementation File for Tree Printer
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "TreePrinter.h"
+
+//***************************************************************************
+//		Constructor.  A limit of zero or less turns that limit off, which
+//	is the default for both.
+//
+//	Parameters:
+//		sink: the stream the text is written to.
+//		depthLimit: the most levels to show.
+//		widthLimit: the most characters to show on a line.
+//***************************************************************************
+TreePrinter::TreePrinter(ostream& sink, int depthLimit, int widthLimit)
+	: out(sink), maxDepth(depthLimit), maxWidth(widthLimit)
+{
+	buffer.reserve(TREE_PRINTER_BUFFER_SIZE);
+}
+
+//***************************************************************************
+//		Helper method to add a line to the buffer, writing the buffer out
+//	first if the line would not fit.
+//
+//	Parameters:
+//		line: the text of the line, without the line break.
+//***************************************************************************
+void TreePrinter::WriteLine(const string& line)
+{
+	if (buffer.size() + line.size() + 1 > TREE_PRINTER_BUFFER_SIZE)
+	{
+		Flush();
+	}
+	buffer.append(line);
+	buffer.push_back('\n');
+}
+
+//***************************************************************************
+//		Method to write everything in the buffer to the stream.
+//
+//	Parameters: N/A.
+//***************************************************************************
+void TreePrinter::Flush()
+{
+	if (!buffer.empty())
+	{
+		out.write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+	out.flush();
+}
+
+//***************************************************************************
+//		Destructor.  Writes out anything left in the buffer.
+//
+//	Parameters: N/A.
+//***************************************************************************
+TreePrinter::~TreePrinter()
+{
+	Flush();
+}
@@ -0,0 +1,21 @@
+//***************************************************************************
+//	Implementation File for Templated Aggregate Stack and Aggregate Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "AggregateStack.h"
+
+template class AggregateStack<int, MinOp<int> >;
+template class AggregateStack<int, MaxOp<int> >;
+template class AggregateStack<int, SumOp<int> >;
+template class AggregateStack<double, MinOp<double> >;
+template class AggregateStack<double, MaxOp<double> >;
+template class AggregateStack<double, SumOp<double> >;
+
+template class AggregateQueue<int, MinOp<int> >;
+template class AggregateQueue<int, MaxOp<int> >;
+template class AggregateQueue<int, SumOp<int> >;
+template class AggregateQueue<double, MinOp<double> >;
+template class AggregateQueue<double, MaxOp<double> >;
+template class AggregateQueue<double, SumOp<double> >;
@@ -0,0 +1,291 @@
+//***************************************************************************
+//	Header File for Templated Aggregate Stack and Aggregate Queue
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _AGGREGATESTACK_H
+#define _AGGREGATESTACK_H
+
+#include <iostream>
+#include <limits>
+#include "ArrayStack.h"
+using namespace std;
+
+//***************************************************************************
+//	Monoids for the aggregate containers.  An operation supplies an 
+//	Identity() value and an associative Combine(a, b).  Combine does not 
+//	need to be commutative; the aggregate is always folded from the oldest
+//	element to the newest.  Custom operations follow the same shape.
+//***************************************************************************
+template<class T>
+struct MinOp
+{
+	static T Identity() { return numeric_limits<T>::max(); }
+	static T Combine(const T& a, const T& b) { return (b < a) ? b : a; }
+};
+
+template<class T>
+struct MaxOp
+{
+	static T Identity() { return numeric_limits<T>::lowest(); }
+	static T Combine(const T& a, const T& b) { return (a < b) ? b : a; }
+};
+
+template<class T>
+struct SumOp
+{
+	static T Identity() { return T(); }
+	static T Combine(const T& a, const T& b) { return a + b; }
+};
+
+//***************************************************************************
+//	Stack that keeps, next to every element, the aggregate of that element
+//	and everything below it.  The aggregate of the whole stack is therefore
+//	always on top and can be read in O(1) after any Push or Pop.
+//***************************************************************************
+template<class T, class Op>
+class AggregateStack
+{
+public:
+	AggregateStack(){}
+
+	void Push(T item);
+	void Pop();
+	bool TryPop(T& out);
+	bool IsEmpty() const { return values.IsEmpty(); }
+	T Peek() const { return values.Peek(); }
+	int Size() const { return values.Size(); }
+	void Clear() { values.Clear(); aggregates.Clear(); }
+	
+	T Aggregate() const;
+
+private:
+	ArrayStack<T> values;
+	ArrayStack<T> aggregates;
+};
+
+//***************************************************************************
+//	FIFO queue built from two aggregate stacks, giving the aggregate of 
+//	every element in the queue in O(1) and amortized O(1) Enqueue and 
+//	Dequeue.  New elements go onto the back stack.  When the front stack 
+//	runs dry, the back stack is poured into it in one pass, reversing the 
+//	order so the oldest element is on top.  Suited to sliding windows.
+//***************************************************************************
+template<class T, class Op>
+class AggregateQueue
+{
+public:
+	AggregateQueue(){}
+
+	void Enqueue(T item) { back.Push(item); }
+	void Dequeue();
+	bool TryDequeue(T& out);
+	bool IsEmpty() const { return (frontValues.IsEmpty() && back.IsEmpty()); }
+	int Size() const { return frontValues.Size() + back.Size(); }
+	void Clear();
+	
+	T Aggregate() const;
+
+private:
+	ArrayStack<T>         frontValues;
+	ArrayStack<T>         frontAggregates;
+	AggregateStack<T, Op> back;
+	
+	void Transfer();
+};
+
+// The methods are defined here rather than in AggregateStack.cpp so that
+// the containers can be used with any element type and custom operation.
+// AggregateStack.cpp instantiates the built in operations for int and
+// double.
+
+//***************************************************************************
+//		Stack method will push the new item onto the stack together with 
+//	the aggregate of the stack including the new item.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T, class Op>
+void AggregateStack<T, Op>::Push(T item)
+{
+	if (aggregates.IsEmpty())
+	{
+		aggregates.Push(item);
+	}
+	else
+	{
+		aggregates.Push(Op::Combine(aggregates.Peek(), item));
+	}
+	values.Push(item);
+}
+
+//***************************************************************************
+//		Stack method will pop the top most item and its aggregate off the 
+//	stack.  If the stack is empty, then a message will be displayed to the
+//	user.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, class Op>
+void AggregateStack<T, Op>::Pop()
+{
+	if (values.IsEmpty())
+	{
+		cerr << "The stack is empty." << endl;
+		return;
+	}
+	
+	values.Pop();
+	aggregates.Pop();
+}
+
+//***************************************************************************
+//		Stack method will copy the top most item into out and remove it 
+//	from the stack.  Returns false, leaving out untouched, if the stack is
+//	empty.
+//
+//	Parameters:
+//		out: receives the element that was on top of the stack.
+//***************************************************************************
+template<class T, class Op>
+bool AggregateStack<T, Op>::TryPop(T& out)
+{
+	if (values.IsEmpty())
+	{
+		return false;
+	}
+	
+	out = values.Peek();
+	values.Pop();
+	aggregates.Pop();
+	return true;
+}
+
+//***************************************************************************
+//		Stack method to return the aggregate of every element on the stack,
+//	or the identity of the operation if the stack is empty.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, class Op>
+T AggregateStack<T, Op>::Aggregate() const
+{
+	if (aggregates.IsEmpty())
+	{
+		return Op::Identity();
+	}
+	return aggregates.Peek();
+}
+
+//***************************************************************************
+//		Queue method to remove the oldest item from the queue.  If the 
+//	queue is empty, then a message will be displayed to the user.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, class Op>
+void AggregateQueue<T, Op>::Dequeue()
+{
+	T item;
+	
+	if (!TryDequeue(item))
+	{
+		cerr << "The queue is empty." << endl;
+	}
+}
+
+//***************************************************************************
+//		Queue method will copy the oldest item into out and remove it from
+//	the queue.  Returns false, leaving out untouched, if the queue is 
+//	empty.
+//
+//	Parameters:
+//		out: receives the element that was at the front of the queue.
+//***************************************************************************
+template<class T, class Op>
+bool AggregateQueue<T, Op>::TryDequeue(T& out)
+{
+	if (frontValues.IsEmpty())
+	{
+		Transfer();
+	}
+	
+	if (frontValues.IsEmpty())
+	{
+		return false;
+	}
+	
+	out = frontValues.Peek();
+	frontValues.Pop();
+	frontAggregates.Pop();
+	return true;
+}
+
+//***************************************************************************
+//		Queue method to remove every item from the queue.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, class Op>
+void AggregateQueue<T, Op>::Clear()
+{
+	frontValues.Clear();
+	frontAggregates.Clear();
+	back.Clear();
+}
+
+//***************************************************************************
+//		Queue method to return the aggregate of every element in the queue,
+//	or the identity of the operation if the queue is empty.  The front 
+//	stack holds the older elements, so its aggregate is combined first.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, class Op>
+T AggregateQueue<T, Op>::Aggregate() const
+{
+	if (frontAggregates.IsEmpty())
+	{
+		return back.Aggregate();
+	}
+	if (back.IsEmpty())
+	{
+		return frontAggregates.Peek();
+	}
+	return Op::Combine(frontAggregates.Peek(), back.Aggregate());
+}
+
+//***************************************************************************
+//		Queue method to pour the back stack into the empty front stack.  
+//	Items arrive newest first, so each new front aggregate combines the 
+//	item on the left of the aggregate already below it.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, class Op>
+void AggregateQueue<T, Op>::Transfer()
+{
+	T item;
+	
+	while (back.TryPop(item))
+	{
+		if (frontAggregates.IsEmpty())
+		{
+			frontAggregates.Push(item);
+		}
+		else
+		{
+			frontAggregates.Push(Op::Combine(item, frontAggregates.Peek()));
+		}
+		frontValues.Push(item);
+	}
+}
+#endif
@@ -0,0 +1,212 @@
+//***************************************************************************
+//	Implementation File for Templated Array Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "ArrayStack.h"
+
+//***************************************************************************
+//		Stack method will push the new item onto the top of the stack.  If
+//	the buffer is full, its capacity will be doubled first.  If a bad memory
+//	allocation exception is detected, then an appropriate message will be 
+//	displayed to the user, and the item will not be pushed.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T>
+void ArrayStack<T>::Push(T item)
+{
+	if (top == capacity)
+	{
+		try
+		{
+			Reserve(capacity == 0 ? ARRAY_STACK_MIN_CAPACITY : capacity * 2);
+		}
+		catch (bad_alloc & ex)
+		{
+			cerr << "Failed to push " << item << " onto the stack." << endl;
+			return;
+		}
+	}
+	
+	items[top] = std::move(item);
+	top = top + 1;
+}
+
+//***************************************************************************
+//		Stack method will pop the top most item off the stack, unless the 
+//	stack is empty.  If the stack is empty, then a message will be displayed
+//	to the user.  The buffer is kept for later pushes.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void ArrayStack<T>::Pop()
+{
+	if (top == 0)
+	{
+		cerr << "The stack is empty." << endl;
+	}
+	else
+	{
+		top = top - 1;
+	}
+}
+
+//***************************************************************************
+//		Stack method will return the top most value off the stack.  If the
+//	stack is empty, then an appropriate message will be displayed to the 
+//	user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+T ArrayStack<T>::Peek() const
+{
+	if (top == 0)
+	{
+		cerr << "The stack is empty." << endl;
+		return T();
+	}
+	else
+	{
+		return items[top - 1];
+	}
+}
+
+//***************************************************************************
+//		Stack method to grow the buffer so it can hold at least newCapacity
+//	items without reallocating.  The existing items are moved into the new
+//	buffer in a single pass.  Requests that do not grow the buffer are 
+//	ignored.  May throw bad_alloc, in which case the stack is unchanged.
+//
+//	Parameters:
+//		newCapacity: the number of items the stack should be able to hold.
+//***************************************************************************
+template<class T>
+void ArrayStack<T>::Reserve(int newCapacity)
+{
+	if (newCapacity <= capacity)
+	{
+		return;
+	}
+	
+	T* newItems = new T[newCapacity];
+	for (int i = 0; i < top; i++)
+	{
+		newItems[i] = std::move(items[i]);
+	}
+	
+	delete[] items;
+	items = newItems;
+	capacity = newCapacity;
+}
+
+//***************************************************************************
+//		Stack method that will return true if the item is in the stack, and
+//	false otherwise.  The search starts at the top of the stack.
+//
+//	Parameters:
+//		item: the element to be searched for
+//***************************************************************************
+template<class T>
+bool ArrayStack<T>::Search(T item) const
+{
+	for (int i = top - 1; i >= 0; i--)
+	{
+		if (items[i] == item)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//***************************************************************************
+//		Stack method that will print the contents of the stack.  The top 
+//	element will be enclosed in square brackets to denote the top.     
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void ArrayStack<T>::Print() const
+{
+	if (top == 0)
+	{
+		return;
+	}
+	
+	cout << "-------------" << endl;
+	cout << "[" << items[top - 1] << "]" << endl;
+	
+	for (int i = top - 2; i >= 0; i--)
+	{
+		cout << items[i] << endl;
+	}
+	cout << "-------------" << endl;
+}
+
+//***************************************************************************
+//		Copy Constructor.
+//***************************************************************************
+template<class T>
+ArrayStack<T>::ArrayStack(const ArrayStack<T>& myStack)
+	: items(NULL), top(0), capacity(0)
+{
+	if (myStack.top == 0)
+	{
+		return;
+	}
+	
+	Reserve(myStack.top);
+	for (int i = 0; i < myStack.top; i++)
+	{
+		items[i] = myStack.items[i];
+	}
+	top = myStack.top;
+}
+
+//***************************************************************************
+//		Assignment Operator.
+//***************************************************************************
+template<class T>
+ArrayStack<T>& ArrayStack<T>::operator=(const ArrayStack<T>& myStack)
+{
+	if (this == &myStack)
+	{
+		return *this;
+	}
+	
+	top = 0;
+	Reserve(myStack.top);
+	for (int i = 0; i < myStack.top; i++)
+	{
+		items[i] = myStack.items[i];
+	}
+	top = myStack.top;
+	return *this;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T>
+ArrayStack<T>::~ArrayStack()
+{
+	delete[] items;
+	items = NULL;
+	top = 0;
+	capacity = 0;
+}
+
+template class ArrayStack<int>;
+template class ArrayStack<double>;
+template class ArrayStack<float>;
+template class ArrayStack<char>;
+template class ArrayStack<bool>;
+template class ArrayStack<string>;
@@ -0,0 +1,51 @@
+//***************************************************************************
+//	Header File for Templated Array Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _ARRAYSTACK_H
+#define _ARRAYSTACK_H
+
+#include <iostream>
+#include <string>
+#include <utility>
+using namespace std;
+
+// Number of slots allocated by the first push onto an empty stack.
+#define ARRAY_STACK_MIN_CAPACITY 16
+
+//***************************************************************************
+//	Stack that keeps its elements in one contiguous buffer.  The buffer 
+//	doubles when it is full, so pushes are amortized O(1) and no memory is 
+//	allocated or released per element.
+//***************************************************************************
+template<class T>
+class ArrayStack
+{
+public:
+	ArrayStack(): items(NULL), top(0), capacity(0){}
+
+	void Push(T item);
+	void Pop();
+	bool IsEmpty() const { return (top == 0); }
+	T Peek() const;
+	int Size() const { return top; }
+	
+	void Reserve(int newCapacity);
+	int Capacity() const { return capacity; }
+	void Clear() { top = 0; }
+	
+	bool Search(T item) const;
+	void Print() const;
+
+	ArrayStack(const ArrayStack& myStack);
+	ArrayStack& operator=(const ArrayStack& myStack);
+	~ArrayStack();
+
+private:
+	T*  items;
+	int top;
+	int capacity;
+};
+#endif
@@ -0,0 +1,351 @@
+//***************************************************************************
+//	Implementation File for Templated Lock-Free Concurrent Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "ConcurrentStack.h"
+
+// Index stored in a list word to mark the end of the list.
+#define CSTACK_NIL 0xFFFFFFFFu
+
+// Helpers to pack and unpack the {tag, index} words.
+#define CSTACK_INDEX(word)     ((unsigned int)((word) & 0xFFFFFFFFull))
+#define CSTACK_TAG(word)       ((unsigned int)((word) >> 32))
+#define CSTACK_PACK(tag, idx)  (((unsigned long long)(tag) << 32) | (idx))
+
+//***************************************************************************
+//		Constructor.  Both the stack and the free list start out empty, and
+//	no node chunks are allocated until the first push.
+//***************************************************************************
+template<class T>
+ConcurrentStack<T>::ConcurrentStack()
+	: top(CSTACK_PACK(0, CSTACK_NIL)), freeList(CSTACK_PACK(0, CSTACK_NIL)),
+	  nextIndex(0), offerTag(1), count(0), chunks(NULL)
+{
+	for (int i = 0; i < CSTACK_ELIM_SLOTS; i++)
+	{
+		slots[i].store(0, std::memory_order_relaxed);
+	}
+	
+	chunks = new std::atomic<CStackNode<T>*>[CSTACK_MAX_CHUNKS];
+	for (int i = 0; i < CSTACK_MAX_CHUNKS; i++)
+	{
+		chunks[i].store(NULL, std::memory_order_relaxed);
+	}
+}
+
+//***************************************************************************
+//		Stack method will push the new item onto the stack.  The item is 
+//	stored in a node taken from the free list (or a fresh one), and the 
+//	node is then published either on top of the stack or, under 
+//	contention, directly to a waiting pop through the elimination array.
+//	If a bad memory allocation exception is detected, then an appropriate
+//	message will be displayed, and the item will not be pushed.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T>
+void ConcurrentStack<T>::Push(T item)
+{
+	unsigned int index = 0;
+	
+	try
+	{
+		index = AllocNode();
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to push " << item << " onto the stack." << endl;
+		return;
+	}
+	
+	GetNode(index)->data = std::move(item);
+	count.fetch_add(1, std::memory_order_relaxed);
+	
+	while (!TryPushIndex(top, index) && !EliminatePush(index))
+	{
+	}
+}
+
+//***************************************************************************
+//		Stack method will move the top most item into out and remove it 
+//	from the stack.  Under contention the pop may instead be satisfied by
+//	a concurrent push through the elimination array.  Returns false, 
+//	leaving out untouched, if the stack is empty.
+//
+//	Parameters:
+//		out: receives the element that was on top of the stack.
+//***************************************************************************
+template<class T>
+bool ConcurrentStack<T>::TryPop(T& out)
+{
+	unsigned int index  = CSTACK_NIL;
+	int          status = POP_CONTENDED;
+	
+	while (status == POP_CONTENDED)
+	{
+		status = TryPopIndex(top, index);
+		if (status == POP_CONTENDED && EliminatePop(index))
+		{
+			status = POP_OK;
+		}
+	}
+	
+	if (status == POP_EMPTY)
+	{
+		return false;
+	}
+	
+	out = std::move(GetNode(index)->data);
+	FreeNode(index);
+	count.fetch_sub(1, std::memory_order_relaxed);
+	return true;
+}
+
+//***************************************************************************
+//		Stack method to report whether the stack was empty at the moment it
+//	was checked.  Other threads may change this immediately afterwards.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+bool ConcurrentStack<T>::IsEmpty() const
+{
+	return CSTACK_INDEX(top.load(std::memory_order_acquire)) == CSTACK_NIL;
+}
+
+//***************************************************************************
+//		Method to translate a node index into the address of the node.
+//
+//	Parameters:
+//		index: the index of the node.
+//***************************************************************************
+template<class T>
+CStackNode<T>* ConcurrentStack<T>::GetNode(unsigned int index) const
+{
+	CStackNode<T>* chunk = chunks[index >> CSTACK_CHUNK_SHIFT].load(
+	                                              std::memory_order_acquire);
+	return &chunk[index & (CSTACK_CHUNK_SIZE - 1)];
+}
+
+//***************************************************************************
+//		Method to obtain an unused node.  Recycled nodes are taken from the
+//	free list first.  Otherwise the next never used index is claimed, and 
+//	the chunk holding it is allocated if no thread has done so yet.  
+//	Throws bad_alloc if the index space or memory is exhausted.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+unsigned int ConcurrentStack<T>::AllocNode()
+{
+	unsigned int index  = CSTACK_NIL;
+	int          status = POP_CONTENDED;
+	
+	while (status == POP_CONTENDED)
+	{
+		status = TryPopIndex(freeList, index);
+	}
+	
+	if (status == POP_OK)
+	{
+		return index;
+	}
+	
+	index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+	if (index >= (unsigned int)CSTACK_MAX_CHUNKS * CSTACK_CHUNK_SIZE)
+	{
+		throw bad_alloc();
+	}
+	
+	std::atomic<CStackNode<T>*>& chunk = chunks[index >> CSTACK_CHUNK_SHIFT];
+	if (chunk.load(std::memory_order_acquire) == NULL)
+	{
+		CStackNode<T>* fresh    = new CStackNode<T>[CSTACK_CHUNK_SIZE];
+		CStackNode<T>* expected = NULL;
+		
+		if (!chunk.compare_exchange_strong(expected, fresh, 
+		                                   std::memory_order_acq_rel))
+		{
+			delete[] fresh;
+		}
+	}
+	return index;
+}
+
+//***************************************************************************
+//		Method to return a node to the free list for later reuse.
+//
+//	Parameters:
+//		index: the index of the node.
+//***************************************************************************
+template<class T>
+void ConcurrentStack<T>::FreeNode(unsigned int index)
+{
+	while (!TryPushIndex(freeList, index))
+	{
+	}
+}
+
+//***************************************************************************
+//		Method to make one attempt at linking a node onto the front of a 
+//	tagged list.  Returns false if another thread changed the list first.
+//
+//	Parameters:
+//		list: the tagged list word (the stack top or the free list).
+//		index: the index of the node to be linked.
+//***************************************************************************
+template<class T>
+bool ConcurrentStack<T>::TryPushIndex(std::atomic<unsigned long long>& list, 
+                                      unsigned int index)
+{
+	unsigned long long oldWord = list.load(std::memory_order_relaxed);
+	unsigned long long newWord = CSTACK_PACK(CSTACK_TAG(oldWord) + 1, index);
+	
+	GetNode(index)->next.store(CSTACK_INDEX(oldWord), 
+	                           std::memory_order_relaxed);
+	return list.compare_exchange_strong(oldWord, newWord, 
+	                                    std::memory_order_release,
+	                                    std::memory_order_relaxed);
+}
+
+//***************************************************************************
+//		Method to make one attempt at unlinking the front node of a tagged
+//	list.  Returns POP_OK with the node index, POP_EMPTY if the list was
+//	empty, or POP_CONTENDED if another thread changed the list first.
+//
+//	Parameters:
+//		list: the tagged list word (the stack top or the free list).
+//		index: receives the index of the unlinked node.
+//***************************************************************************
+template<class T>
+int ConcurrentStack<T>::TryPopIndex(std::atomic<unsigned long long>& list, 
+                                    unsigned int& index)
+{
+	unsigned long long oldWord = list.load(std::memory_order_acquire);
+	unsigned int       front   = CSTACK_INDEX(oldWord);
+	
+	if (front == CSTACK_NIL)
+	{
+		return POP_EMPTY;
+	}
+	
+	unsigned int next = GetNode(front)->next.load(std::memory_order_relaxed);
+	unsigned long long newWord = CSTACK_PACK(CSTACK_TAG(oldWord) + 1, next);
+	
+	if (!list.compare_exchange_strong(oldWord, newWord, 
+	                                  std::memory_order_acquire,
+	                                  std::memory_order_relaxed))
+	{
+		return POP_CONTENDED;
+	}
+	
+	index = front;
+	return POP_OK;
+}
+
+//***************************************************************************
+//		Method to offer a node to a concurrent pop.  The offer is placed in
+//	a random empty slot and left there briefly.  Returns true if a pop 
+//	took the node, and false if the slot was busy or the offer was 
+//	withdrawn unclaimed.
+//
+//	Parameters:
+//		index: the index of the node being pushed.
+//***************************************************************************
+template<class T>
+bool ConcurrentStack<T>::EliminatePush(unsigned int index)
+{
+	std::atomic<unsigned long long>& slot = slots[PickSlot()];
+	unsigned long long offer = CSTACK_PACK(
+	             offerTag.fetch_add(1, std::memory_order_relaxed), index + 1);
+	unsigned long long expected = 0;
+	
+	if (!slot.compare_exchange_strong(expected, offer, 
+	                                  std::memory_order_acq_rel))
+	{
+		return false;
+	}
+	
+	for (int i = 0; i < CSTACK_ELIM_SPINS; i++)
+	{
+		if (slot.load(std::memory_order_acquire) != offer)
+		{
+			return true;
+		}
+	}
+	
+	expected = offer;
+	return !slot.compare_exchange_strong(expected, 0, 
+	                                     std::memory_order_acq_rel);
+}
+
+//***************************************************************************
+//		Method to take a node offered by a concurrent push.  Returns true 
+//	with the node index if an offer was claimed, and false otherwise.
+//
+//	Parameters:
+//		index: receives the index of the claimed node.
+//***************************************************************************
+template<class T>
+bool ConcurrentStack<T>::EliminatePop(unsigned int& index)
+{
+	std::atomic<unsigned long long>& slot = slots[PickSlot()];
+	unsigned long long offer = slot.load(std::memory_order_acquire);
+	
+	if (offer == 0 || !slot.compare_exchange_strong(offer, 0, 
+	                                     std::memory_order_acq_rel))
+	{
+		return false;
+	}
+	
+	index = CSTACK_INDEX(offer) - 1;
+	return true;
+}
+
+//***************************************************************************
+//		Method to choose an elimination slot using a per-thread xorshift
+//	generator, so contending threads spread across the array.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+unsigned int ConcurrentStack<T>::PickSlot() const
+{
+	static thread_local unsigned int seed = 0;
+	
+	if (seed == 0)
+	{
+		seed = (unsigned int)(unsigned long long)&seed | 1u;
+	}
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed % CSTACK_ELIM_SLOTS;
+}
+
+//***************************************************************************
+//		Destructor.  Must not run while other threads still use the stack.
+//***************************************************************************
+template<class T>
+ConcurrentStack<T>::~ConcurrentStack()
+{
+	for (int i = 0; i < CSTACK_MAX_CHUNKS; i++)
+	{
+		delete[] chunks[i].load(std::memory_order_relaxed);
+	}
+	delete[] chunks;
+	chunks = NULL;
+}
+
+template class ConcurrentStack<int>;
+template class ConcurrentStack<double>;
+template class ConcurrentStack<float>;
+template class ConcurrentStack<char>;
+template class ConcurrentStack<bool>;
+template class ConcurrentStack<string>;
@@ -0,0 +1,93 @@
+//***************************************************************************
+//	Header File for Templated Lock-Free Concurrent Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _CONCURRENTSTACK_H
+#define _CONCURRENTSTACK_H
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <utility>
+using namespace std;
+
+// Nodes are allocated in chunks of 2^CSTACK_CHUNK_SHIFT and addressed by a
+// 32-bit index, so the stack can hold up to CSTACK_MAX_CHUNKS chunks.
+#define CSTACK_CHUNK_SHIFT 12
+#define CSTACK_CHUNK_SIZE  (1 << CSTACK_CHUNK_SHIFT)
+#define CSTACK_MAX_CHUNKS  (1 << 16)
+
+// Number of exchange slots in the elimination array, and how many times a
+// pushing thread polls its slot before withdrawing the offer.
+#define CSTACK_ELIM_SLOTS  16
+#define CSTACK_ELIM_SPINS  64
+
+template<class T>
+class ConcurrentStack;
+
+template<class T>
+class CStackNode
+{
+	T data;
+	std::atomic<unsigned int> next;
+
+	CStackNode(): data(), next(0){}
+
+	friend class ConcurrentStack<T>;
+};
+
+//***************************************************************************
+//	Lock-free Treiber stack that may be shared by any number of threads.
+//
+//	The top of the stack is a 64-bit word holding a 32-bit node index and
+//	a 32-bit version tag.  Every successful update bumps the tag, so a 
+//	thread that read a stale top cannot succeed with its compare-exchange
+//	even if the same node has since been popped and pushed again (ABA).  
+//	Popped nodes go onto an internal free list, and node memory is only
+//	released by the destructor, so a thread reading a node that another
+//	thread just popped never touches freed memory.
+//
+//	When a compare-exchange on the top fails, the thread tries to pair up
+//	with an opposite operation in the elimination array.  A push and a pop
+//	that meet there cancel out without touching the top at all.
+//***************************************************************************
+template<class T>
+class ConcurrentStack
+{
+public:
+	ConcurrentStack();
+
+	void Push(T item);
+	bool TryPop(T& out);
+	bool IsEmpty() const;
+	int Size() const { return count.load(std::memory_order_relaxed); }
+
+	ConcurrentStack(const ConcurrentStack&) = delete;
+	ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+	~ConcurrentStack();
+
+private:
+	enum PopStatus { POP_OK, POP_EMPTY, POP_CONTENDED };
+	
+	std::atomic<unsigned long long> top;
+	std::atomic<unsigned long long> freeList;
+	std::atomic<unsigned long long> slots[CSTACK_ELIM_SLOTS];
+	std::atomic<unsigned int>       nextIndex;
+	std::atomic<unsigned int>       offerTag;
+	std::atomic<int>                count;
+	std::atomic<CStackNode<T>*>*    chunks;
+
+	CStackNode<T>* GetNode(unsigned int index) const;
+	unsigned int AllocNode();
+	void FreeNode(unsigned int index);
+	
+	bool TryPushIndex(std::atomic<unsigned long long>& list, unsigned int index);
+	int TryPopIndex(std::atomic<unsigned long long>& list, unsigned int& index);
+	
+	bool EliminatePush(unsigned int index);
+	bool EliminatePop(unsigned int& index);
+	unsigned int PickSlot() const;
+};
+#endif
@@ -0,0 +1,214 @@
+//***************************************************************************
+//	Implementation File for Templated Persistent Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "PersistentStack.h"
+
+//***************************************************************************
+//		Private constructor that adopts a node the caller already holds a 
+//	reference to.
+//
+//	Parameters:
+//		top: the top node of the new version.
+//***************************************************************************
+template<class T>
+PersistentStack<T>::PersistentStack(const PStackNode<T>* top): head(top)
+{
+}
+
+//***************************************************************************
+//		Stack method will return a new version of the stack with the item 
+//	on top.  This stack is not changed; the new version shares all of its
+//	nodes.  If a bad memory allocation exception is detected, then an 
+//	appropriate message will be displayed, and an unchanged copy returned.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T>
+PersistentStack<T> PersistentStack<T>::Push(T item) const
+{
+	try
+	{
+		PStackNode<T>* top = new PStackNode<T>(item, head, Size() + 1);
+		Retain(head);
+		return PersistentStack<T>(top);
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to push " << item << " onto the stack." << endl;
+	}
+	return *this;
+}
+
+//***************************************************************************
+//		Stack method will return a new version of the stack without its top
+//	item.  This stack is not changed.  If the stack is empty, then a 
+//	message will be displayed and an empty stack returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+PersistentStack<T> PersistentStack<T>::Pop() const
+{
+	if (head == NULL)
+	{
+		cerr << "The stack is empty." << endl;
+		return PersistentStack<T>();
+	}
+	
+	Retain(head->next);
+	return PersistentStack<T>(head->next);
+}
+
+//***************************************************************************
+//		Stack method will return the top most value of the stack.  If the
+//	stack is empty, then an appropriate message will be displayed to the 
+//	user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+T PersistentStack<T>::Peek() const
+{
+	if (head == NULL)
+	{
+		cerr << "The stack is empty." << endl;
+		return T();
+	}
+	return head->data;
+}
+
+//***************************************************************************
+//		Stack method that will return true if the item is in this version
+//	of the stack, and false otherwise.
+//
+//	Parameters:
+//		item: the element to be searched for
+//***************************************************************************
+template<class T>
+bool PersistentStack<T>::Search(T item) const
+{
+	const PStackNode<T>* temp = head;
+	
+	while (temp != NULL)
+	{
+		if (temp->data == item)
+		{
+			return true;
+		}
+		temp = temp->next;
+	}
+	return false;
+}
+
+//***************************************************************************
+//		Stack method that will print the contents of the stack.  The top 
+//	element will be enclosed in square brackets to denote the top.     
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void PersistentStack<T>::Print() const
+{
+	if (head == NULL)
+	{
+		return;
+	}
+	
+	const PStackNode<T>* temp = head;
+	cout << "-------------" << endl;
+	cout << "[" << temp->data << "]" << endl;
+	temp = temp->next;
+	
+	while (temp != NULL)
+	{
+		cout << temp->data << endl;
+		temp = temp->next;
+	}
+	cout << "-------------" << endl;
+}
+
+//***************************************************************************
+//		Method to add a reference to a node, if there is one.
+//
+//	Parameters:
+//		node: the node being shared.
+//***************************************************************************
+template<class T>
+void PersistentStack<T>::Retain(const PStackNode<T>* node)
+{
+	if (node != NULL)
+	{
+		node->refCount = node->refCount + 1;
+	}
+}
+
+//***************************************************************************
+//		Method to drop a reference to a node.  Every node whose count falls
+//	to zero is deleted, and the walk continues down the chain iteratively 
+//	so releasing a deep stack cannot overflow the call stack.
+//
+//	Parameters:
+//		node: the node being released.
+//***************************************************************************
+template<class T>
+void PersistentStack<T>::Release(const PStackNode<T>* node)
+{
+	while (node != NULL)
+	{
+		node->refCount = node->refCount - 1;
+		if (node->refCount > 0)
+		{
+			return;
+		}
+		
+		const PStackNode<T>* next = node->next;
+		delete node;
+		node = next;
+	}
+}
+
+//***************************************************************************
+//		Copy Constructor.  Shares the nodes of the other stack in O(1).
+//***************************************************************************
+template<class T>
+PersistentStack<T>::PersistentStack(const PersistentStack<T>& myStack)
+	: head(myStack.head)
+{
+	Retain(head);
+}
+
+//***************************************************************************
+//		Assignment Operator.  Shares the nodes of the other stack in O(1).
+//***************************************************************************
+template<class T>
+PersistentStack<T>& PersistentStack<T>::operator=(const PersistentStack<T>& myStack)
+{
+	Retain(myStack.head);
+	Release(head);
+	head = myStack.head;
+	return *this;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T>
+PersistentStack<T>::~PersistentStack()
+{
+	Release(head);
+	head = NULL;
+}
+
+template class PersistentStack<int>;
+template class PersistentStack<double>;
+template class PersistentStack<float>;
+template class PersistentStack<char>;
+template class PersistentStack<bool>;
+template class PersistentStack<string>;
@@ -0,0 +1,68 @@
+//***************************************************************************
+//	Header File for Templated Persistent Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _PERSISTENTSTACK_H
+#define _PERSISTENTSTACK_H
+
+#include <iostream>
+#include <string>
+using namespace std;
+
+template<class T>
+class PersistentStack;
+
+template<class T>
+class PStackNode
+{
+	T                 data;
+	const PStackNode* next;
+	int               size;
+	mutable int       refCount;
+	
+	PStackNode(T item, const PStackNode* ptr, int newSize)
+		: data(item), next(ptr), size(newSize), refCount(1){};
+
+	friend class PersistentStack<T>;
+};
+
+//***************************************************************************
+//	Stack whose nodes are never modified once built.  A stack is only a 
+//	reference to its top node, and nodes are shared between every version
+//	that contains them and reference counted.  Copying a stack, and so 
+//	taking a snapshot, is O(1).  Push and Pop leave the stack untouched and
+//	return the new version, which shares everything below the top.
+//
+//	Reference counts are not atomic, so a version must not be copied or
+//	released by two threads at once.
+//***************************************************************************
+template<class T>
+class PersistentStack
+{
+public:
+	PersistentStack(): head(NULL){}
+
+	PersistentStack Push(T item) const;
+	PersistentStack Pop() const;
+	bool IsEmpty() const { return (head == NULL); }
+	T Peek() const;
+	int Size() const { return (head == NULL) ? 0 : head->size; }
+	
+	bool Search(T item) const;
+	void Print() const;
+
+	PersistentStack(const PersistentStack& myStack);
+	PersistentStack& operator=(const PersistentStack& myStack);
+	~PersistentStack();
+
+private:
+	const PStackNode<T>* head;
+	
+	explicit PersistentStack(const PStackNode<T>* top);
+	
+	static void Retain(const PStackNode<T>* node);
+	static void Release(const PStackNode<T>* node);
+};
+#endif
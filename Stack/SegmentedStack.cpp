@@ -0,0 +1,377 @@
+//***************************************************************************
+//	Implementation File for Templated Segmented Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "SegmentedStack.h"
+
+//***************************************************************************
+//		Constructor.  No chunk is allocated until the first push.
+//
+//	Parameters:
+//		newChunkSize: the number of elements held by each chunk.
+//		newSpareLimit: the number of empty chunks to keep for reuse.
+//***************************************************************************
+template<class T>
+SegmentedStack<T>::SegmentedStack(int newChunkSize, int newSpareLimit)
+	: topChunk(NULL), spares(NULL), top(0), count(0), 
+	  chunkSize(newChunkSize > 0 ? newChunkSize : SEG_STACK_CHUNK_SIZE),
+	  spareLimit(newSpareLimit > 0 ? newSpareLimit : 0), 
+	  chunksInUse(0), spareChunks(0), peakChunks(0)
+{
+}
+
+//***************************************************************************
+//		Stack method will push the new item onto the stack.  If the top 
+//	chunk is full, a spare chunk is reused or a new one allocated.  If a 
+//	bad memory allocation exception is detected, then an appropriate 
+//	message will be displayed, and the item will not be pushed.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::Push(T item)
+{
+	if (topChunk == NULL || top == chunkSize)
+	{
+		try
+		{
+			AddChunk();
+		}
+		catch (bad_alloc & ex)
+		{
+			cerr << "Failed to push " << item << " onto the stack." << endl;
+			return;
+		}
+	}
+	
+	topChunk->items[top] = std::move(item);
+	top = top + 1;
+	count = count + 1;
+}
+
+//***************************************************************************
+//		Stack method will pop the top most item off the stack, unless the 
+//	stack is empty.  If the stack is empty, then a message will be displayed
+//	to the user.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::Pop()
+{
+	T item;
+	
+	if (!TryPop(item))
+	{
+		cerr << "The stack is empty." << endl;
+	}
+}
+
+//***************************************************************************
+//		Stack method will remove the top most item from the stack and 
+//	return it in one step.  If the stack is empty, then a message will be
+//	displayed to the user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+T SegmentedStack<T>::PopValue()
+{
+	T item = T();
+	
+	if (!TryPop(item))
+	{
+		cerr << "The stack is empty." << endl;
+	}
+	return item;
+}
+
+//***************************************************************************
+//		Stack method will move the top most item into out and remove it 
+//	from the stack.  When the top chunk empties it is retired.  Returns 
+//	false, leaving out untouched, if the stack is empty.
+//
+//	Parameters:
+//		out: receives the element that was on top of the stack.
+//***************************************************************************
+template<class T>
+bool SegmentedStack<T>::TryPop(T& out)
+{
+	if (count == 0)
+	{
+		return false;
+	}
+	
+	top = top - 1;
+	count = count - 1;
+	out = std::move(topChunk->items[top]);
+	
+	if (top == 0)
+	{
+		RemoveChunk();
+	}
+	return true;
+}
+
+//***************************************************************************
+//		Stack method will return the top most value off the stack.  If the
+//	stack is empty, then an appropriate message will be displayed to the 
+//	user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+T SegmentedStack<T>::Peek() const
+{
+	if (count == 0)
+	{
+		cerr << "The stack is empty." << endl;
+		return T();
+	}
+	return topChunk->items[top - 1];
+}
+
+//***************************************************************************
+//		Stack method to remove every item.  Emptied chunks go through the 
+//	normal spare policy.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::Clear()
+{
+	while (topChunk != NULL)
+	{
+		RemoveChunk();
+	}
+	count = 0;
+}
+
+//***************************************************************************
+//		Stack method to change how many empty chunks are kept for reuse.  
+//	Spares beyond the new limit are freed immediately.
+//
+//	Parameters:
+//		newSpareLimit: the number of empty chunks to keep.
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::SetSpareLimit(int newSpareLimit)
+{
+	spareLimit = (newSpareLimit > 0) ? newSpareLimit : 0;
+	TrimSpares(spareLimit);
+}
+
+//***************************************************************************
+//		Stack method to report the memory held by the stack: every chunk in
+//	use or kept as a spare, plus the chunk headers and the stack itself.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+long long SegmentedStack<T>::ResidentBytes() const
+{
+	long long chunks = chunksInUse + spareChunks;
+	
+	return chunks * ((long long)chunkSize * sizeof(T) + 
+	                 sizeof(SegStackChunk<T>)) + sizeof(*this);
+}
+
+//***************************************************************************
+//		Stack method that will print the contents of the stack.  The top 
+//	element will be enclosed in square brackets to denote the top.     
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::Print() const
+{
+	if (count == 0)
+	{
+		return;
+	}
+	
+	SegStackChunk<T>* chunk = topChunk;
+	int               idx   = top - 1;
+	
+	cout << "-------------" << endl;
+	cout << "[" << chunk->items[idx] << "]" << endl;
+	idx = idx - 1;
+	
+	while (chunk != NULL)
+	{
+		while (idx >= 0)
+		{
+			cout << chunk->items[idx] << endl;
+			idx = idx - 1;
+		}
+		chunk = chunk->prev;
+		idx = chunkSize - 1;
+	}
+	cout << "-------------" << endl;
+}
+
+//***************************************************************************
+//		Method to put a fresh chunk on top of the stack, reusing a spare if
+//	one is cached.  May throw bad_alloc.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::AddChunk()
+{
+	SegStackChunk<T>* chunk = spares;
+	
+	if (chunk != NULL)
+	{
+		spares = chunk->prev;
+		spareChunks = spareChunks - 1;
+	}
+	else
+	{
+		chunk = new SegStackChunk<T>(chunkSize);
+	}
+	
+	chunk->prev = topChunk;
+	topChunk = chunk;
+	top = 0;
+	
+	chunksInUse = chunksInUse + 1;
+	if (chunksInUse > peakChunks)
+	{
+		peakChunks = chunksInUse;
+	}
+}
+
+//***************************************************************************
+//		Method to retire the empty top chunk.  It is kept as a spare if the
+//	spare list is below its limit, and freed otherwise.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::RemoveChunk()
+{
+	SegStackChunk<T>* chunk = topChunk;
+	
+	topChunk = chunk->prev;
+	top = (topChunk == NULL) ? 0 : chunkSize;
+	chunksInUse = chunksInUse - 1;
+	
+	if (spareChunks < spareLimit)
+	{
+		chunk->prev = spares;
+		spares = chunk;
+		spareChunks = spareChunks + 1;
+	}
+	else
+	{
+		delete chunk;
+	}
+}
+
+//***************************************************************************
+//		Method to free spare chunks until no more than limit remain.
+//
+//	Parameters:
+//		limit: the number of spare chunks to keep.
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::TrimSpares(int limit)
+{
+	while (spareChunks > limit)
+	{
+		SegStackChunk<T>* chunk = spares;
+		spares = chunk->prev;
+		delete chunk;
+		spareChunks = spareChunks - 1;
+	}
+}
+
+//***************************************************************************
+//		Method to push a copy of every item of another stack, bottom first.
+//
+//	Parameters:
+//		myStack: the stack to be copied.
+//***************************************************************************
+template<class T>
+void SegmentedStack<T>::CopyFrom(const SegmentedStack<T>& myStack)
+{
+	int                      numChunks = myStack.chunksInUse;
+	const SegStackChunk<T>** order     = new const SegStackChunk<T>*[numChunks];
+	const SegStackChunk<T>*  chunk     = myStack.topChunk;
+	
+	for (int i = numChunks - 1; i >= 0; i--)
+	{
+		order[i] = chunk;
+		chunk = chunk->prev;
+	}
+	
+	for (int i = 0; i < numChunks; i++)
+	{
+		int used = (i == numChunks - 1) ? myStack.top : myStack.chunkSize;
+		for (int j = 0; j < used; j++)
+		{
+			Push(order[i]->items[j]);
+		}
+	}
+	delete[] order;
+}
+
+//***************************************************************************
+//		Copy Constructor.
+//***************************************************************************
+template<class T>
+SegmentedStack<T>::SegmentedStack(const SegmentedStack<T>& myStack)
+	: topChunk(NULL), spares(NULL), top(0), count(0), 
+	  chunkSize(myStack.chunkSize), spareLimit(myStack.spareLimit), 
+	  chunksInUse(0), spareChunks(0), peakChunks(0)
+{
+	CopyFrom(myStack);
+}
+
+//***************************************************************************
+//		Assignment Operator.
+//***************************************************************************
+template<class T>
+SegmentedStack<T>& SegmentedStack<T>::operator=(const SegmentedStack<T>& myStack)
+{
+	if (this == &myStack)
+	{
+		return *this;
+	}
+	
+	Clear();
+	TrimSpares(0);
+	chunkSize = myStack.chunkSize;
+	spareLimit = myStack.spareLimit;
+	CopyFrom(myStack);
+	return *this;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T>
+SegmentedStack<T>::~SegmentedStack()
+{
+	Clear();
+	TrimSpares(0);
+}
+
+template class SegmentedStack<int>;
+template class SegmentedStack<double>;
+template class SegmentedStack<float>;
+template class SegmentedStack<char>;
+template class SegmentedStack<bool>;
+template class SegmentedStack<string>;
@@ -0,0 +1,87 @@
+//***************************************************************************
+//	Header File for Templated Segmented Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _SEGMENTEDSTACK_H
+#define _SEGMENTEDSTACK_H
+
+#include <iostream>
+#include <string>
+#include <utility>
+using namespace std;
+
+// Default number of elements per chunk and number of empty chunks kept.
+#define SEG_STACK_CHUNK_SIZE  4096
+#define SEG_STACK_SPARE_LIMIT 1
+
+template<class T>
+class SegmentedStack;
+
+template<class T>
+class SegStackChunk
+{
+	T*             items;
+	SegStackChunk* prev;
+	
+	SegStackChunk(int chunkSize): items(new T[chunkSize]), prev(NULL){};
+	~SegStackChunk() { delete[] items; }
+
+	friend class SegmentedStack<T>;
+};
+
+//***************************************************************************
+//	Stack that grows in fixed size chunks linked together, so growing 
+//	never copies existing elements and draining releases memory chunk by 
+//	chunk.  Emptied chunks are kept on a spare list, up to the spare limit,
+//	so a stack that hovers around a chunk boundary does not allocate and 
+//	free the same chunk over and over.  Chunks beyond the limit are freed 
+//	as soon as they empty.
+//***************************************************************************
+template<class T>
+class SegmentedStack
+{
+public:
+	SegmentedStack(int newChunkSize = SEG_STACK_CHUNK_SIZE, 
+	               int newSpareLimit = SEG_STACK_SPARE_LIMIT);
+
+	void Push(T item);
+	void Pop();
+	T PopValue();
+	bool TryPop(T& out);
+	bool IsEmpty() const { return (count == 0); }
+	T Peek() const;
+	int Size() const { return count; }
+	void Clear();
+	
+	void SetSpareLimit(int newSpareLimit);
+	void ReleaseSpares() { TrimSpares(0); }
+	int ChunkCount() const { return chunksInUse; }
+	int SpareCount() const { return spareChunks; }
+	int PeakChunkCount() const { return peakChunks; }
+	long long ResidentBytes() const;
+	
+	void Print() const;
+
+	SegmentedStack(const SegmentedStack& myStack);
+	SegmentedStack& operator=(const SegmentedStack& myStack);
+	~SegmentedStack();
+
+private:
+	SegStackChunk<T>* topChunk;
+	SegStackChunk<T>* spares;
+	int top;
+	int count;
+	int chunkSize;
+	int spareLimit;
+	int chunksInUse;
+	int spareChunks;
+	int peakChunks;
+	
+	void AddChunk();
+	void RemoveChunk();
+	void TrimSpares(int limit);
+	void CopyFrom(const SegmentedStack& myStack);
+};
+#endif
@@ -0,0 +1,15 @@
+//***************************************************************************
+//	Implementation File for Templated Small Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "SmallStack.h"
+
+template class SmallStack<int>;
+template class SmallStack<double>;
+template class SmallStack<float>;
+template class SmallStack<char>;
+template class SmallStack<bool>;
+template class SmallStack<string>;
+template class SmallStack<int, 8>;
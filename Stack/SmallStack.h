@@ -0,0 +1,292 @@
+//***************************************************************************
+//	Header File for Templated Small Stack
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _SMALLSTACK_H
+#define _SMALLSTACK_H
+
+#include <iostream>
+#include <string>
+#include <utility>
+using namespace std;
+
+//***************************************************************************
+//	Stack that stores its first N elements inside the object itself.  Only
+//	when a push would exceed N are the elements moved to a heap buffer, 
+//	which then doubles as needed.  Shallow stacks never touch the heap.
+//***************************************************************************
+template<class T, int N = 32>
+class SmallStack
+{
+public:
+	SmallStack(): items(inlineItems), top(0), capacity(N){}
+
+	void Push(T item);
+	void Pop();
+	T PopValue();
+	bool TryPop(T& out);
+	bool IsEmpty() const { return (top == 0); }
+	T Peek() const;
+	int Size() const { return top; }
+	
+	void Clear() { top = 0; }
+	int Capacity() const { return capacity; }
+	bool IsInline() const { return (items == inlineItems); }
+	
+	bool Search(T item) const;
+	void Print() const;
+
+	SmallStack(const SmallStack& myStack);
+	SmallStack& operator=(const SmallStack& myStack);
+	~SmallStack();
+
+private:
+	T   inlineItems[N];
+	T*  items;
+	int top;
+	int capacity;
+	
+	void Grow();
+};
+
+// The methods are defined here rather than in SmallStack.cpp so that a
+// stack can be declared with any inline size N.  SmallStack.cpp 
+// instantiates the default size for the common element types.
+
+//***************************************************************************
+//		Stack method will push the new item onto the top of the stack.  If
+//	the current storage is full, it will be grown first.  If a bad memory
+//	allocation exception is detected, then an appropriate message will be 
+//	displayed to the user, and the item will not be pushed.
+//
+//	Parameters:
+//		item: the element to be pushed.
+//***************************************************************************
+template<class T, int N>
+void SmallStack<T, N>::Push(T item)
+{
+	if (top == capacity)
+	{
+		try
+		{
+			Grow();
+		}
+		catch (bad_alloc & ex)
+		{
+			cerr << "Failed to push " << item << " onto the stack." << endl;
+			return;
+		}
+	}
+	
+	items[top] = std::move(item);
+	top = top + 1;
+}
+
+//***************************************************************************
+//		Stack method will pop the top most item off the stack, unless the 
+//	stack is empty.  If the stack is empty, then a message will be displayed
+//	to the user.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, int N>
+void SmallStack<T, N>::Pop()
+{
+	if (top == 0)
+	{
+		cerr << "The stack is empty." << endl;
+	}
+	else
+	{
+		top = top - 1;
+	}
+}
+
+//***************************************************************************
+//		Stack method will remove the top most item from the stack and 
+//	return it in one step.  If the stack is empty, then a message will be
+//	displayed to the user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, int N>
+T SmallStack<T, N>::PopValue()
+{
+	T item = T();
+	
+	if (!TryPop(item))
+	{
+		cerr << "The stack is empty." << endl;
+	}
+	return item;
+}
+
+//***************************************************************************
+//		Stack method will move the top most item into out and remove it 
+//	from the stack.  Returns false, leaving out untouched, if the stack is
+//	empty.
+//
+//	Parameters:
+//		out: receives the element that was on top of the stack.
+//***************************************************************************
+template<class T, int N>
+bool SmallStack<T, N>::TryPop(T& out)
+{
+	if (top == 0)
+	{
+		return false;
+	}
+	
+	top = top - 1;
+	out = std::move(items[top]);
+	return true;
+}
+
+//***************************************************************************
+//		Stack method will return the top most value off the stack.  If the
+//	stack is empty, then an appropriate message will be displayed to the 
+//	user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, int N>
+T SmallStack<T, N>::Peek() const
+{
+	if (top == 0)
+	{
+		cerr << "The stack is empty." << endl;
+		return T();
+	}
+	else
+	{
+		return items[top - 1];
+	}
+}
+
+//***************************************************************************
+//		Stack method to double the storage of the stack.  The first time 
+//	this is called the items spill out of the inline storage into a heap 
+//	buffer.  May throw bad_alloc, in which case the stack is unchanged.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, int N>
+void SmallStack<T, N>::Grow()
+{
+	int newCapacity = capacity * 2;
+	T*  newItems    = new T[newCapacity];
+	
+	for (int i = 0; i < top; i++)
+	{
+		newItems[i] = std::move(items[i]);
+	}
+	
+	if (items != inlineItems)
+	{
+		delete[] items;
+	}
+	items = newItems;
+	capacity = newCapacity;
+}
+
+//***************************************************************************
+//		Stack method that will return true if the item is in the stack, and
+//	false otherwise.  The search starts at the top of the stack.
+//
+//	Parameters:
+//		item: the element to be searched for
+//***************************************************************************
+template<class T, int N>
+bool SmallStack<T, N>::Search(T item) const
+{
+	for (int i = top - 1; i >= 0; i--)
+	{
+		if (items[i] == item)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//***************************************************************************
+//		Stack method that will print the contents of the stack.  The top 
+//	element will be enclosed in square brackets to denote the top.     
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T, int N>
+void SmallStack<T, N>::Print() const
+{
+	if (top == 0)
+	{
+		return;
+	}
+	
+	cout << "-------------" << endl;
+	cout << "[" << items[top - 1] << "]" << endl;
+	
+	for (int i = top - 2; i >= 0; i--)
+	{
+		cout << items[i] << endl;
+	}
+	cout << "-------------" << endl;
+}
+
+//***************************************************************************
+//		Copy Constructor.
+//***************************************************************************
+template<class T, int N>
+SmallStack<T, N>::SmallStack(const SmallStack<T, N>& myStack)
+	: items(inlineItems), top(0), capacity(N)
+{
+	*this = myStack;
+}
+
+//***************************************************************************
+//		Assignment Operator.
+//***************************************************************************
+template<class T, int N>
+SmallStack<T, N>& SmallStack<T, N>::operator=(const SmallStack<T, N>& myStack)
+{
+	if (this == &myStack)
+	{
+		return *this;
+	}
+	
+	top = 0;
+	while (capacity < myStack.top)
+	{
+		Grow();
+	}
+	
+	for (int i = 0; i < myStack.top; i++)
+	{
+		items[i] = myStack.items[i];
+	}
+	top = myStack.top;
+	return *this;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+template<class T, int N>
+SmallStack<T, N>::~SmallStack()
+{
+	if (items != inlineItems)
+	{
+		delete[] items;
+	}
+	items = inlineItems;
+	top = 0;
+	capacity = N;
+}
+#endif
@@ -20,6 +20,7 @@ void Stack<T>::Push(T item)
 	try
 	{
 		head = new StackNode<T>(item, head);
+		count = count + 1;
 	}
 	catch (bad_alloc & ex)
 	{
@@ -46,10 +47,56 @@ void Stack<T>::Pop()
     {
 		StackNode<T>* ptr = head;
 		head = head->next;
-		delete[] ptr;
+		delete ptr;
+		count = count - 1;
 	}  
 }
 
+//***************************************************************************
+//		Stack method will remove the top most item from the stack and 
+//	return it in one step.  The value is moved out of the node rather than
+//	copied.  If the stack is empty, then a message will be displayed to the
+//	user and a default value returned.
+//
+//	Parameters:
+//		N/A
+//***************************************************************************
+template<class T>
+T Stack<T>::PopValue()
+{
+	T item = T();
+	
+	if (!TryPop(item))
+	{
+		cerr << "The stack is empty." << endl;
+	}
+	return item;
+}
+
+//***************************************************************************
+//		Stack method will move the top most item into out and remove it 
+//	from the stack.  Returns false, leaving out untouched, if the stack is
+//	empty.  No message is displayed, so this is suited to drain loops.
+//
+//	Parameters:
+//		out: receives the element that was on top of the stack.
+//***************************************************************************
+template<class T>
+bool Stack<T>::TryPop(T& out)
+{
+	if (head == NULL)
+	{
+		return false;
+	}
+	
+	StackNode<T>* ptr = head;
+	out = std::move(ptr->data);
+	head = head->next;
+	delete ptr;
+	count = count - 1;
+	return true;
+}
+
 //***************************************************************************
 //		Stack method will return the top most value off the stack.  If the
 //	stack is empty, then an appropriate message will be displayed to the 
@@ -73,34 +120,6 @@ T Stack<T>::Peek()const
     }
 }
 
-//***************************************************************************
-//		Stack method to return the size of the stack.     
-//
-//	Parameters:
-//		N/A
-//***************************************************************************
-
-template<class T>
-int Stack<T>::Size() const
-{
-	int size = 0;
-	
-	if (head == NULL)
-	{
-		return 0;
-	}
-	else
-	{
-		StackNode<T>* temp = head;
-		while (temp != NULL)
-		{
-			temp = temp->next;
-			size = size + 1;
-		}
-		return size;
-	}
-}
-
 //***************************************************************************
 //		Stack method that will return NULL if the stack is empty, or if the
 //	item is not found, after displaying a message to the user.  If the item 
@@ -176,6 +195,7 @@ void Stack<T>::Print()const
 template<class T>
 Stack<T>::Stack(const Stack<T>& myStack)
 {
+	count = myStack.count;
 	if (!myStack.head)
 	{
 		head = NULL; 
@@ -204,8 +224,9 @@ Stack<T>& Stack<T>::operator=(const Stack<T>& myStack)
 	{
 		return *this;
 	}
-	this->~Stack();
+	Clear();
 
+	count = myStack.count;
 	if (!myStack.head)
 	{ 
 		head = NULL; 
@@ -226,11 +247,13 @@ Stack<T>& Stack<T>::operator=(const Stack<T>& myStack)
 }
 
 //***************************************************************************
-//		Destructor.
+//		Stack method to remove and deallocate every item on the stack.
+//
+//	Parameters:
+//		N/A
 //***************************************************************************
-
 template<class T>
-Stack<T>::~Stack()
+void Stack<T>::Clear()
 {
     while(head != NULL)
 	{
@@ -239,6 +262,17 @@ Stack<T>::~Stack()
         head = temp;
     }
     head = NULL;   
+    count = 0;
+}
+
+//***************************************************************************
+//		Destructor.
+//***************************************************************************
+
+template<class T>
+Stack<T>::~Stack()
+{
+	Clear();
 }
 
 template class Stack<int>;
@@ -8,6 +8,7 @@
 #define _STACK_H
 
 #include <iostream>
+#include <utility>
 using namespace std;
 
 template<class T>
@@ -30,13 +31,16 @@ template<class T>
 class Stack
 {
 public:
-	Stack():head(NULL){}
+	Stack():head(NULL), count(0){}
 
 	void Push(T item);
 	void Pop();
+	T PopValue();
+	bool TryPop(T& out);
 	bool IsEmpty() const { return (head == NULL); }
 	T Peek() const;
-	int Size() const;
+	int Size() const { return count; }
+	void Clear();
 		
 	StackNode<T>* Search(T item) const;	
 	void Print() const;
@@ -47,5 +51,6 @@ public:
 	
 private:
 	StackNode<T>* head;	                                 
+	int count;
 };
 #endif
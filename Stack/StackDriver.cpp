@@ -155,7 +155,7 @@ void choose(Stack<T>& myStack)
 			}
 			case 'd': case 'D':
 			{
-				myStack.~Stack();
+				myStack.Clear();
 				break;
 			}
             case 'q': case 'Q':
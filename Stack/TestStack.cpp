@@ -116,6 +116,20 @@ void TestStack<U>::runTests()
 			testNotFoundSearch();
 			
 			testSearch();
+			
+			testTryPop();
+			
+			testSmallStack();
+			
+			testAggregateStack();
+			
+			testSegmentedStack();
+			
+			benchmarkArrayStack();
+			
+			benchmarkConcurrentStack();
+			
+			benchmarkPersistentStack();
 		}
 		else
 		{
@@ -206,7 +220,7 @@ bool TestStack<U>::testPop()
 	{
 		testLogger.logEvent("Clearing the queue before further testing.", 
 		                                                           INFO);
-		testStack.~Stack();
+		testStack.Clear();
 		if (testStack.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the stack.", OK);
@@ -302,7 +316,7 @@ bool TestStack<U>::bulkPop()
 	{
 		testLogger.logEvent("Clearing the stack before further testing.", 
 		                                                           INFO);
-		testStack.~Stack();
+		testStack.Clear();
 		if (testStack.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the stack.", OK);
@@ -393,7 +407,7 @@ bool TestStack<U>::testPeek()
 	{
 		testLogger.logEvent("Clearing the stack before further testing.", 
 		                                                           INFO);
-		testStack.~Stack();
+		testStack.Clear();
 		if (testStack.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the stack.", OK);
@@ -477,7 +491,7 @@ bool TestStack<U>::testEmptyStackSearch()
 	{
 		testLogger.logEvent("Clearing the stack before further testing.", 
 		                                                           INFO);
-		testStack.~Stack();
+		testStack.Clear();
 		if (testStack.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the stack.", OK);
@@ -563,7 +577,7 @@ bool TestStack<U>::testNotFoundSearch()
 	{
 		testLogger.logEvent("Clearing the stack before further testing.", 
 		                                                           INFO);
-		testStack.~Stack();
+		testStack.Clear();
 		if (testStack.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the stack.", OK);
@@ -645,7 +659,7 @@ bool TestStack<U>::testSearch()
 	{
 		testLogger.logEvent("Clearing the stack before further testing.", 
 		                                                           INFO);
-		testStack.~Stack();
+		testStack.Clear();
 		if (testStack.Size() == 0)
 		{
 			testLogger.logEvent("Successfully cleared the stack.", OK);
@@ -712,3 +726,672 @@ bool TestStack<U>::testSearch()
 	std::cout << std::endl;
 	return status;
 }
+
+//****************************************************************************
+//	NAME: testTryPop.
+//
+//	DESCRIPTION: Add 3 items to the stack and remove them with TryPop.  The
+//				 items must come back in the order 3, 2, 1, the size must 
+//				 drop by one each time, and TryPop must fail once the stack
+//				 is empty.
+//****************************************************************************
+template <class U>
+bool TestStack<U>::testTryPop()
+{
+	testLogger.logEvent("***** Begin Try Pop Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		testLogger.logEvent("Clearing the stack before further testing.", 
+		                                                           INFO);
+		testStack.Clear();
+		
+		U value1 = U(1);
+		U value2 = U(2);
+		U value3 = U(3);
+		U out;
+		
+		testLogger.logEvent("Adding 3 values to the stack.", INFO);
+		testStack.Push(value1);
+		testStack.Push(value2);
+		testStack.Push(value3);
+		
+		testLogger.logEvent("Removing the values with TryPop.", INFO);
+		if (!testStack.TryPop(out) || out != value3 || testStack.Size() != 2 ||
+		    !testStack.TryPop(out) || out != value2 || testStack.Size() != 1 ||
+		    !testStack.TryPop(out) || out != value1 || testStack.Size() != 0)
+		{
+			testLogger.logEvent("TryPop returned the wrong item.", FAIL);
+			status = FAIL;
+		}
+		else if (testStack.TryPop(out))
+		{
+			testLogger.logEvent("TryPop succeeded on an empty stack.", FAIL);
+			status = FAIL;
+		}
+		else
+		{
+			testLogger.logEvent("Successfully removed all 3 items.", OK);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "TryPop.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Try Pop Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Try Pop Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Try Pop Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testSmallStack.
+//
+//	DESCRIPTION: Push items onto a small stack until it spills out of its 
+//				 inline storage, then pop them all.  The stack must stay 
+//				 inline up to its inline capacity, and every item must come
+//				 back in reverse order.  
+//****************************************************************************
+template <class U>
+bool TestStack<U>::testSmallStack()
+{
+	testLogger.logEvent("***** Begin Small Stack Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		SmallStack<U, 8> smallStack;
+		
+		testLogger.logEvent("Pushing 8 items to the small stack.", INFO);
+		for (int i = 0; i < 8; i++)
+		{
+			smallStack.Push(U(i));
+		}
+		
+		if (!smallStack.IsInline())
+		{
+			testLogger.logEvent("Stack left inline storage early.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Pushing a 9th item to spill the stack.", INFO);
+		smallStack.Push(U(8));
+		
+		if (smallStack.IsInline() || smallStack.Size() != 9)
+		{
+			testLogger.logEvent("Stack did not spill to the heap.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Popping all items from the stack.", INFO);
+		for (int i = 8; i >= 0; i--)
+		{
+			if (smallStack.PopValue() != U(i))
+			{
+				status = FAIL;
+			}
+		}
+		
+		if (status == OK && smallStack.IsEmpty())
+		{
+			testLogger.logEvent("Items were popped in order.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("Items were not popped in order.", FAIL);
+			status = FAIL;
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the small stack.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Small Stack Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Small Stack Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Small Stack Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testAggregateStack.
+//
+//	DESCRIPTION: Push 5, 3 and 8 onto a minimum stack and check the minimum
+//				 after each push and pop.  Then slide a window of 3 over 
+//				 the values 1 to 10 with a maximum queue and check that the
+//				 maximum is always the newest value.  
+//****************************************************************************
+template <class U>
+bool TestStack<U>::testAggregateStack()
+{
+	testLogger.logEvent("***** Begin Aggregate Stack Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		AggregateStack<U, MinOp<U> > minStack;
+		
+		testLogger.logEvent("Pushing 5, 3 and 8 to the minimum stack.", INFO);
+		minStack.Push(U(5));
+		minStack.Push(U(3));
+		minStack.Push(U(8));
+		
+		if (minStack.Aggregate() != U(3))
+		{
+			testLogger.logEvent("Minimum was not 3 after pushes.", FAIL);
+			status = FAIL;
+		}
+		
+		minStack.Pop();
+		minStack.Pop();
+		if (minStack.Aggregate() != U(5))
+		{
+			testLogger.logEvent("Minimum was not 5 after pops.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Sliding a window of 3 with a maximum queue.", 
+		                    INFO);
+		AggregateQueue<U, MaxOp<U> > maxQueue;
+		for (int i = 1; i <= 10; i++)
+		{
+			maxQueue.Enqueue(U(i));
+			if (maxQueue.Size() > 3)
+			{
+				maxQueue.Dequeue();
+			}
+			
+			if (maxQueue.Aggregate() != U(i))
+			{
+				status = FAIL;
+			}
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("All aggregates were correct.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("An aggregate was incorrect.", FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the aggregate stack.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Aggregate Stack Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Aggregate Stack Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Aggregate Stack Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: testSegmentedStack.
+//
+//	DESCRIPTION: Push a burst of 1,000 items onto a segmented stack with 
+//				 chunks of 64, check the values come back in order while 
+//				 draining, then check that only the spare chunk is still 
+//				 resident.  Finally bounce across a chunk boundary and check
+//				 that no chunk beyond the spare is kept.  
+//****************************************************************************
+template <class U>
+bool TestStack<U>::testSegmentedStack()
+{
+	testLogger.logEvent("***** Begin Segmented Stack Test *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		SegmentedStack<U> segStack(64, 1);
+		long long emptyBytes = segStack.ResidentBytes();
+		
+		testLogger.logEvent("Pushing a burst of 1,000 items.", INFO);
+		for (int i = 0; i < 1000; i++)
+		{
+			segStack.Push(U(i));
+		}
+		
+		if (segStack.ChunkCount() != 16)
+		{
+			testLogger.logEvent("Burst did not use 16 chunks.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Draining the stack.", INFO);
+		for (int i = 999; i >= 0; i--)
+		{
+			if (segStack.PopValue() != U(i))
+			{
+				status = FAIL;
+			}
+		}
+		
+		if (segStack.ChunkCount() != 0 || segStack.SpareCount() != 1)
+		{
+			testLogger.logEvent("Drained stack did not keep one spare.", FAIL);
+			status = FAIL;
+		}
+		
+		testLogger.logEvent("Bouncing across a chunk boundary.", INFO);
+		for (int i = 0; i < 64; i++)
+		{
+			segStack.Push(U(i));
+		}
+		for (int i = 0; i < 100; i++)
+		{
+			segStack.Push(U(i));
+			segStack.Pop();
+		}
+		
+		if (segStack.ChunkCount() + segStack.SpareCount() != 2 || 
+		    segStack.PeakChunkCount() != 16)
+		{
+			testLogger.logEvent("Boundary bounce kept extra chunks.", FAIL);
+			status = FAIL;
+		}
+		
+		segStack.Clear();
+		segStack.ReleaseSpares();
+		if (segStack.ResidentBytes() != emptyBytes)
+		{
+			testLogger.logEvent("Released stack still holds chunks.", FAIL);
+			status = FAIL;
+		}
+		
+		if (status == OK)
+		{
+			testLogger.logEvent("Segmented stack released its chunks.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("Segmented stack kept the wrong chunks.", 
+			                    FAIL);
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while testing "
+		                     "the segmented stack.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Segmented Stack Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Segmented Stack Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Segmented Stack Test *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkArrayStack.
+//
+//	DESCRIPTION: Push and then pop 1,000,000 items on the node based stack 
+//				 and on the array stack, and display the time taken by 
+//				 each.  
+//****************************************************************************
+template <class U>
+bool TestStack<U>::benchmarkArrayStack()
+{
+	testLogger.logEvent("***** Begin Array Stack Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int BENCH_SIZE = 1000000;
+		U         value;
+		
+		testLogger.logEvent("Clearing the stack before benchmarking.", INFO);
+		testStack.Clear();
+		
+		steady_clock::time_point start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testStack.Push(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			testStack.Pop();
+		}
+		steady_clock::time_point end = steady_clock::now();
+		long long nodeTime = duration_cast<milliseconds>(end - start).count();
+		
+		ArrayStack<U> arrayStack;
+		
+		start = steady_clock::now();
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			arrayStack.Push(value);
+		}
+		for (int i = 0; i < BENCH_SIZE; i++)
+		{
+			arrayStack.Pop();
+		}
+		end = steady_clock::now();
+		long long arrayTime = duration_cast<milliseconds>(end - start).count();
+		
+		std::cout << "     Node Stack: " << std::endl;
+		std::cout << "                Push/Pop time = " << nodeTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "    Array Stack: " << std::endl;
+		std::cout << "                Push/Pop time = " << arrayTime;
+		std::cout << " ms." << std::endl << std::endl;
+		
+		if (testStack.IsEmpty() && arrayStack.IsEmpty())
+		{
+			testLogger.logEvent("Both stacks were drained.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("A stack was not drained.", FAIL);
+			status = FAIL;
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the array stack.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Array Stack Benchmark Passed.", OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Array Stack Benchmark Failed.", FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Array Stack Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkConcurrentStack.
+//
+//	DESCRIPTION: Share one stack between 1 to 64 threads, each pushing and
+//				 popping its share of 400,000 items, and display the time 
+//				 taken by the lock-free stack and by a node based stack 
+//				 guarded by a mutex.  Every pushed item must be popped.  
+//****************************************************************************
+template <class U>
+bool TestStack<U>::benchmarkConcurrentStack()
+{
+	testLogger.logEvent("***** Begin Concurrent Stack Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int TOTAL_OPS       = 400000;
+		const int THREAD_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };
+		const int NUM_COUNTS      = sizeof(THREAD_COUNTS) / sizeof(int);
+		
+		for (int t = 0; t < NUM_COUNTS; t++)
+		{
+			int numThreads = THREAD_COUNTS[t];
+			int opsPerThread = TOTAL_OPS / numThreads;
+			
+			ConcurrentStack<U>  lockFreeStack;
+			std::atomic<int>    lockFreePops(0);
+			std::vector<std::thread> workers;
+			
+			steady_clock::time_point start = steady_clock::now();
+			for (int w = 0; w < numThreads; w++)
+			{
+				workers.push_back(std::thread([&]()
+				{
+					U value = U();
+					for (int i = 0; i < opsPerThread; i++)
+					{
+						lockFreeStack.Push(value);
+						if (lockFreeStack.TryPop(value))
+						{
+							lockFreePops.fetch_add(1);
+						}
+					}
+				}));
+			}
+			for (int w = 0; w < numThreads; w++)
+			{
+				workers[w].join();
+			}
+			steady_clock::time_point end = steady_clock::now();
+			long long lockFreeTime = 
+			                duration_cast<milliseconds>(end - start).count();
+			
+			Stack<U>   lockedStack;
+			std::mutex stackMutex;
+			int        lockedPops = 0;
+			workers.clear();
+			
+			start = steady_clock::now();
+			for (int w = 0; w < numThreads; w++)
+			{
+				workers.push_back(std::thread([&]()
+				{
+					U value = U();
+					for (int i = 0; i < opsPerThread; i++)
+					{
+						std::lock_guard<std::mutex> lock(stackMutex);
+						lockedStack.Push(value);
+						if (lockedStack.TryPop(value))
+						{
+							lockedPops = lockedPops + 1;
+						}
+					}
+				}));
+			}
+			for (int w = 0; w < numThreads; w++)
+			{
+				workers[w].join();
+			}
+			end = steady_clock::now();
+			long long lockedTime = 
+			                duration_cast<milliseconds>(end - start).count();
+			
+			std::cout << "     " << numThreads << " thread(s): " << std::endl;
+			std::cout << "                Lock-free time = " << lockFreeTime;
+			std::cout << " ms." << std::endl;
+			std::cout << "                    Mutex time = " << lockedTime;
+			std::cout << " ms." << std::endl;
+			
+			if (lockFreePops.load() + lockFreeStack.Size() != 
+			    opsPerThread * numThreads ||
+			    lockedPops != opsPerThread * numThreads)
+			{
+				testLogger.logEvent("Items were lost by a stack.", FAIL);
+				status = FAIL;
+			}
+		}
+		std::cout << std::endl;
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the concurrent stack.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Concurrent Stack Benchmark Passed.", 
+		                              OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Concurrent Stack Benchmark Failed.", 
+		                              FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Concurrent Stack Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: benchmarkPersistentStack.
+//
+//	DESCRIPTION: Run a backtracking search that snapshots its path at every
+//				 branch of a binary tree of depth 18, once with deep copies
+//				 of the node based stack and once with the persistent 
+//				 stack, and display the time taken by each.  Both searches 
+//				 must reach every leaf.  
+//****************************************************************************
+template <class U>
+bool TestStack<U>::benchmarkPersistentStack()
+{
+	testLogger.logEvent("***** Begin Persistent Stack Benchmark *****", INFO);
+	int status = OK;
+	
+	try
+	{
+		const int SEARCH_DEPTH = 18;
+		
+		steady_clock::time_point start = steady_clock::now();
+		long long copyLeaves = backtrackCopy(Stack<U>(), SEARCH_DEPTH);
+		steady_clock::time_point end = steady_clock::now();
+		long long copyTime = duration_cast<milliseconds>(end - start).count();
+		
+		start = steady_clock::now();
+		long long persistentLeaves = 
+		              backtrackPersistent(PersistentStack<U>(), SEARCH_DEPTH);
+		end = steady_clock::now();
+		long long persistentTime = 
+		                      duration_cast<milliseconds>(end - start).count();
+		
+		std::cout << "      Deep Copy: " << std::endl;
+		std::cout << "                Search time = " << copyTime;
+		std::cout << " ms." << std::endl;
+		std::cout << "     Persistent: " << std::endl;
+		std::cout << "                Search time = " << persistentTime;
+		std::cout << " ms." << std::endl << std::endl;
+		
+		if (copyLeaves == (1LL << SEARCH_DEPTH) && 
+		    persistentLeaves == (1LL << SEARCH_DEPTH))
+		{
+			testLogger.logEvent("Both searches reached every leaf.", OK);
+		}
+		else
+		{
+			testLogger.logEvent("A search missed some leaves.", FAIL);
+			status = FAIL;
+		}
+	}
+	catch(...)
+	{
+		std::string errMsg = "Unexpected exception caught while "
+		                     "benchmarking the persistent stack.";
+		testLogger.logEvent(errMsg, FAIL);
+		status = FAIL;
+	}
+	
+	if (status == OK)
+	{
+		testLogger.printStatusMessage("Persistent Stack Benchmark Passed.", 
+		                              OK);
+	}
+	else
+	{
+		testLogger.printStatusMessage("Persistent Stack Benchmark Failed.", 
+		                              FAIL);
+		testLogger.setPassingStatus(status);
+	}
+	
+	testLogger.logEvent("***** End Persistent Stack Benchmark *****", INFO);
+	std::cout << std::endl;
+	return status;
+}
+
+//****************************************************************************
+//	NAME: backtrackCopy.
+//
+//	DESCRIPTION: Backtracking step for the deep copy benchmark.  The path 
+//				 is taken by value, so each branch works on its own deep 
+//				 copy.  Returns the number of leaves whose path is full.  
+//****************************************************************************
+template <class U>
+long long TestStack<U>::backtrackCopy(Stack<U> path, int depth)
+{
+	if (depth == 0)
+	{
+		return (path.Size() > 0) ? 1 : 0;
+	}
+	
+	path.Push(U(depth));
+	return backtrackCopy(path, depth - 1) + backtrackCopy(path, depth - 1);
+}
+
+//****************************************************************************
+//	NAME: backtrackPersistent.
+//
+//	DESCRIPTION: Backtracking step for the persistent benchmark.  Each 
+//				 branch receives an O(1) snapshot of the path.  Returns the
+//				 number of leaves whose path is full.  
+//****************************************************************************
+template <class U>
+long long TestStack<U>::backtrackPersistent(PersistentStack<U> path, 
+                                            int depth)
+{
+	if (depth == 0)
+	{
+		return (path.Size() > 0) ? 1 : 0;
+	}
+	
+	PersistentStack<U> next = path.Push(U(depth));
+	return backtrackPersistent(next, depth - 1) + 
+	       backtrackPersistent(next, depth - 1);
+}
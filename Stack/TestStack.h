@@ -8,7 +8,18 @@
 #define _TESTSTACK_H
 
 #include "Stack.h"
+#include "ArrayStack.h"
+#include "SmallStack.h"
+#include "ConcurrentStack.h"
+#include "AggregateStack.h"
+#include "PersistentStack.h"
+#include "SegmentedStack.h"
 #include "Logger.h"
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+using namespace std::chrono;
 
 template <class U>
 class TestStack
@@ -27,10 +38,20 @@ public:
 	bool testEmptyStackSearch();
 	bool testNotFoundSearch();
 	bool testSearch();
+	bool testTryPop();
+	bool testSmallStack();
+	bool testAggregateStack();
+	bool testSegmentedStack();
+	bool benchmarkArrayStack();
+	bool benchmarkConcurrentStack();
+	bool benchmarkPersistentStack();
 
 private:
 	Stack<U> testStack;  
 	Logger testLogger;
+	
+	long long backtrackCopy(Stack<U> path, int depth);
+	long long backtrackPersistent(PersistentStack<U> path, int depth);
 };
 
 #endif 
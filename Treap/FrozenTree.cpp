@@ -0,0 +1,347 @@
+//***************************************************************************
+//	Implementation File for Templated Frozen Search Tree
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#include "FrozenTree.h"
+
+//***************************************************************************
+//		Default Constructor.  Creates an empty frozen tree.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+FrozenTree<T>::FrozenTree()
+	: slots(NULL), count(0)
+{
+}
+
+//***************************************************************************
+//		Constructor that lays out an ascending, duplicate free array of keys.
+//
+//	Parameters:
+//		sortedKeys: the keys in ascending order.
+//		numKeys: the number of keys in the array.
+//***************************************************************************
+template<class T>
+FrozenTree<T>::FrozenTree(const T* sortedKeys, int numKeys)
+	: slots(NULL), count(0)
+{
+	Build(sortedKeys, numKeys);
+}
+
+//***************************************************************************
+//		Copy Constructor.
+//
+//	Parameters:
+//		other: the frozen tree to copy.
+//***************************************************************************
+template<class T>
+FrozenTree<T>::FrozenTree(const FrozenTree<T>& other)
+	: slots(NULL), count(0)
+{
+	*this = other;
+}
+
+//***************************************************************************
+//		Overloaded assignment operator.  The slot array is copied as is,
+//	since it is already in search order.
+//
+//	Parameters:
+//		other: the frozen tree to copy.
+//***************************************************************************
+template<class T>
+FrozenTree<T>& FrozenTree<T>::operator=(const FrozenTree<T>& other)
+{
+	if (this != &other)
+	{
+		Clear();
+		if (other.count > 0)
+		{
+			try
+			{
+				slots = new T[other.count + 1];
+			}
+			catch (bad_alloc & ex)
+			{
+				cerr << "Failed to copy the Frozen Tree." << endl;
+				return *this;
+			}
+
+			for (int i = 1; i <= other.count; i++)
+			{
+				slots[i] = other.slots[i];
+			}
+			count = other.count;
+		}
+	}
+	return *this;
+}
+
+//***************************************************************************
+//		Method to replace the contents with the given keys.  The keys must
+//	be in ascending order with no duplicates, which is what an in order walk
+//	of any of the search trees produces.  If a bad allocation error is
+//	detected, a message will be displayed, the frozen tree left empty and
+//	false returned.
+//
+//	Parameters:
+//		sortedKeys: the keys in ascending order.
+//		numKeys: the number of keys in the array.
+//***************************************************************************
+template<class T>
+bool FrozenTree<T>::Build(const T* sortedKeys, int numKeys)
+{
+	Clear();
+	if (sortedKeys == NULL || numKeys <= 0)
+	{
+		return true;
+	}
+
+	try
+	{
+		// Slot 0 is never used so that the children of k are 2k and 2k + 1.
+		slots = new T[numKeys + 1];
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to allocate the Frozen Tree." << endl;
+		return false;
+	}
+
+	count = numKeys;
+	Fill(sortedKeys, 0, 1);
+	return true;
+}
+
+//***************************************************************************
+//		Helper method that places the keys by walking the implicit tree in
+//	order, so the next key in sorted order lands in the next slot visited.
+//	The implicit tree is complete, so the recursion is only log(n) deep.
+//	Returns the index of the next key to place.
+//
+//	Parameters:
+//		sortedKeys: the keys in ascending order.
+//		next: the index of the next key to place.
+//		slot: the slot of the current subtree root.
+//***************************************************************************
+template<class T>
+int FrozenTree<T>::Fill(const T* sortedKeys, int next, int slot)
+{
+	if (slot <= count)
+	{
+		next = Fill(sortedKeys, next, 2 * slot);
+		slots[slot] = sortedKeys[next];
+		next = Fill(sortedKeys, next + 1, 2 * slot + 1);
+	}
+	return next;
+}
+
+//***************************************************************************
+//		Helper method that walks from the root to past a leaf, going right
+//	whenever the slot is less than the key.  The comparison result is added
+//	into the index rather than branched on.  The path taken is recorded in
+//	the bits of the final index, where every trailing one is a right turn
+//	after the last left turn; stripping those and the left turn itself
+//	gives the slot of the smallest key not less than the given key.
+//	Returns 0 if every key is less than the given key.
+//
+//	Parameters:
+//		key: the key to search for.
+//***************************************************************************
+template<class T>
+int FrozenTree<T>::Descend(const T& key) const
+{
+	size_t k = 1;
+	while (k <= (size_t)count)
+	{
+		FROZEN_PREFETCH(slots + (k << FROZEN_PREFETCH_LEVELS));
+		k = 2 * k + (slots[k] < key);
+	}
+
+	while (k & 1)
+	{
+		k = k >> 1;
+	}
+	return (int)(k >> 1);
+}
+
+//***************************************************************************
+//		Method to determine if a key is in the frozen tree.
+//
+//	Parameters:
+//		key: the key to search for.
+//***************************************************************************
+template<class T>
+bool FrozenTree<T>::Contains(const T& key) const
+{
+	int k = Descend(key);
+	return (k != 0 && !(key < slots[k]));
+}
+
+//***************************************************************************
+//		Method to find the smallest key that is not less than the given key.
+//	Returns false if there is no such key.
+//
+//	Parameters:
+//		key: the key to search for.
+//		result: receives the key that was found.
+//***************************************************************************
+template<class T>
+bool FrozenTree<T>::LowerBound(const T& key, T& result) const
+{
+	int k = Descend(key);
+	if (k == 0)
+	{
+		return false;
+	}
+
+	result = slots[k];
+	return true;
+}
+
+//***************************************************************************
+//		Method to look up several keys at once.  The queries are walked down
+//	the array FROZEN_BATCH_SIZE at a time, one level for all of them before
+//	the next, so the cache misses of different queries overlap instead of
+//	being paid one after another.  Every query passes through the same
+//	number of full levels, and only the last, partly filled level needs a
+//	bounds check.  Returns the number of keys that were found.
+//
+//	Parameters:
+//		keys: the keys to search for.
+//		found: receives whether each key is in the frozen tree.
+//		numKeys: the number of keys to search for.
+//***************************************************************************
+template<class T>
+int FrozenTree<T>::ContainsBatch(const T* keys, bool* found, int numKeys) const
+{
+	T* results = NULL;
+	try
+	{
+		results = new T[numKeys > 0 ? numKeys : 1];
+	}
+	catch (bad_alloc & ex)
+	{
+		cerr << "Failed to allocate the batch results." << endl;
+		return 0;
+	}
+
+	LowerBoundBatch(keys, results, found, numKeys);
+
+	int hits = 0;
+	for (int i = 0; i < numKeys; i++)
+	{
+		found[i] = (found[i] && !(keys[i] < results[i]));
+		hits = hits + found[i];
+	}
+
+	delete[] results;
+	return hits;
+}
+
+//***************************************************************************
+//		Method to find the lower bound of several keys at once, walking the
+//	queries down the array side by side like ContainsBatch.  Returns the
+//	number of keys that have a lower bound.
+//
+//	Parameters:
+//		keys: the keys to search for.
+//		results: receives the lower bound of each key, where there is one.
+//		found: receives whether each key has a lower bound.
+//		numKeys: the number of keys to search for.
+//***************************************************************************
+template<class T>
+int FrozenTree<T>::LowerBoundBatch(const T* keys, T* results, bool* found,
+								   int numKeys) const
+{
+	// Number of levels that are full, so that no path leaves the array.
+	int fullLevels = 0;
+	while (((size_t)1 << (fullLevels + 1)) - 1 <= (size_t)count)
+	{
+		fullLevels++;
+	}
+
+	int hits = 0;
+	size_t k[FROZEN_BATCH_SIZE];
+	for (int first = 0; first < numKeys; first += FROZEN_BATCH_SIZE)
+	{
+		int group = numKeys - first;
+		if (group > FROZEN_BATCH_SIZE)
+		{
+			group = FROZEN_BATCH_SIZE;
+		}
+
+		const T* query = keys + first;
+		for (int i = 0; i < group; i++)
+		{
+			k[i] = 1;
+		}
+
+		for (int level = 0; level < fullLevels; level++)
+		{
+			for (int i = 0; i < group; i++)
+			{
+				FROZEN_PREFETCH(slots + (k[i] << FROZEN_PREFETCH_LEVELS));
+				k[i] = 2 * k[i] + (slots[k[i]] < query[i]);
+			}
+		}
+
+		for (int i = 0; i < group; i++)
+		{
+			if (k[i] <= (size_t)count)
+			{
+				k[i] = 2 * k[i] + (slots[k[i]] < query[i]);
+			}
+
+			while (k[i] & 1)
+			{
+				k[i] = k[i] >> 1;
+			}
+			k[i] = k[i] >> 1;
+
+			found[first + i] = (k[i] != 0);
+			if (k[i] != 0)
+			{
+				results[first + i] = slots[k[i]];
+				hits++;
+			}
+		}
+	}
+	return hits;
+}
+
+//***************************************************************************
+//		Method to release the slot array and leave the frozen tree empty.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+void FrozenTree<T>::Clear()
+{
+	delete[] slots;
+	slots = NULL;
+	count = 0;
+}
+
+//***************************************************************************
+//		Destructor.
+//
+//	Parameters:
+//		N/A.
+//***************************************************************************
+template<class T>
+FrozenTree<T>::~FrozenTree()
+{
+	Clear();
+}
+
+template class FrozenTree<int>;
+template class FrozenTree<double>;
+template class FrozenTree<float>;
+template class FrozenTree<char>;
+template class FrozenTree<bool>;
+template class FrozenTree<string>;
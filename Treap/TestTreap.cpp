@@ -123,6 +123,15 @@ void TestTreap<U>::runTests()
         std::cout << std::endl;
 
         testSearch();
+        std::cout << std::endl;
+
+        testDeepTreap();
+        std::cout << std::endl;
+
+        testFreeze();
+        std::cout << std::endl;
+
+        testForEach();
         testLogger.logEvent("******* End Preliminary Tests *******", INFO);
         std::cout << std::endl;
 
@@ -234,6 +243,318 @@ bool TestTreap<U>::testDelete()
     return false;
 }
 
+//****************************************************************************
+//  NAME: testDeepTreap.
+//
+//  DESCRIPTION: Insert a long run of sorted keys, which gives a deep treap
+//               because many nodes share a priority.  Copy it, check every
+//               key is in the copy, then delete every key.  Each of these 
+//               walks the treap without recursion, so none of them should 
+//               run out of stack.
+// 
+//  PARAMETERS: N/A.
+//****************************************************************************
+template <class U>
+bool TestTreap<U>::testDeepTreap()
+{
+    testLogger.logEvent("******* Begin Deep Treap Test *******", INFO);
+    int status = OK;
+
+    try
+    {
+        const int NUM_KEYS = 200000;
+
+        testLogger.logEvent("Clearing the Treap.", INFO);
+        testTreap.Clear();
+
+        testLogger.logEvent("Inserting " + std::to_string(NUM_KEYS) + " sorted keys into the treap.", INFO);
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            testTreap.Insert(U(i));
+        }
+
+        testLogger.logEvent("Copying the treap.", INFO);
+        Treap<U> copyTreap(testTreap);
+
+        for (int i = 0; i < NUM_KEYS && status == OK; i++)
+        {
+            if (!copyTreap.Search(U(i)))
+            {
+                testLogger.logEvent(std::to_string(i) + " was not found in the copy.", FAIL);
+                status = FAIL;
+            }
+        }
+
+        testLogger.logEvent("Deleting every key from the treap.", INFO);
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            testTreap.Delete(U(i));
+        }
+
+        if (testTreap.Search(U(0)) || testTreap.Search(U(NUM_KEYS - 1)))
+        {
+            testLogger.logEvent("A deleted key was still found in the treap.", FAIL);
+            status = FAIL;
+        }
+        copyTreap.Clear();
+    }
+    catch (...)
+    {
+        testLogger.logEvent("Unexpected exception caught during the Deep Treap Test.", FAIL);
+        status = FAIL;
+    }
+
+    if (status == OK)
+    {
+        testLogger.printStatusMessage("Deep Treap Test Passed.", OK);
+    }
+    else
+    {
+        testLogger.printStatusMessage("Deep Treap Test Failed.", FAIL);
+        testLogger.setPassingStatus(FAIL);
+    }
+
+    testLogger.logEvent("", INFO);
+    testLogger.logEvent("******* End Deep Treap Test *******", INFO);
+    return status;
+}
+
+//****************************************************************************
+//  NAME: testFreeze.
+//
+//  DESCRIPTION: Insert the even keys below a limit in shuffled order and 
+//               freeze the treap.  Every even key should be found in the 
+//               frozen tree and no odd key, the lower bound of an odd key 
+//               should be the next even key, and the batch lookups should
+//               agree with the single ones.
+// 
+//  PARAMETERS: N/A.
+//****************************************************************************
+template <class U>
+bool TestTreap<U>::testFreeze()
+{
+    testLogger.logEvent("******* Begin Freeze Test *******", INFO);
+    int status = OK;
+
+    try
+    {
+        const int NUM_KEYS = 10000;
+        const int LIMIT = 2 * NUM_KEYS;
+
+        testLogger.logEvent("Clearing the Treap.", INFO);
+        testTreap.Clear();
+
+        vector<int> keys;
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            keys.push_back(2 * i);
+        }
+        mt19937 rng(42);
+        shuffle(keys.begin(), keys.end(), rng);
+
+        testLogger.logEvent("Inserting " + std::to_string(NUM_KEYS) + " even keys into the treap.", INFO);
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            testTreap.Insert(U(keys[i]));
+        }
+
+        testLogger.logEvent("Freezing the treap.", INFO);
+        FrozenTree<U> frozen;
+        if (!testTreap.Freeze(frozen) || frozen.Size() != NUM_KEYS)
+        {
+            testLogger.logEvent("The frozen tree does not hold every key.", FAIL);
+            status = FAIL;
+        }
+
+        vector<U> queries;
+        for (int k = 0; k < LIMIT; k++)
+        {
+            queries.push_back(U(k));
+        }
+
+        bool* found = new bool[LIMIT];
+        bool* hasBound = new bool[LIMIT];
+        U* bounds = new U[LIMIT];
+        int hits = frozen.ContainsBatch(&queries[0], found, LIMIT);
+        frozen.LowerBoundBatch(&queries[0], bounds, hasBound, LIMIT);
+
+        if (hits != NUM_KEYS)
+        {
+            testLogger.logEvent("The batch lookup found " + std::to_string(hits) + " keys.", FAIL);
+            status = FAIL;
+        }
+
+        for (int k = 0; k < LIMIT && status == OK; k++)
+        {
+            bool isEven = (k % 2 == 0);
+            U bound = U(0);
+            bool expectBound = (k <= LIMIT - 2);
+
+            if (frozen.Contains(U(k)) != isEven || found[k] != isEven)
+            {
+                testLogger.logEvent("Wrong result when looking up " + std::to_string(k) + ".", FAIL);
+                status = FAIL;
+            }
+            else if (frozen.LowerBound(U(k), bound) != expectBound || hasBound[k] != expectBound ||
+                     (expectBound && (bound != U(k + k % 2) || bounds[k] != bound)))
+            {
+                testLogger.logEvent("Wrong lower bound for " + std::to_string(k) + ".", FAIL);
+                status = FAIL;
+            }
+        }
+
+        delete[] found;
+        delete[] hasBound;
+        delete[] bounds;
+
+        testLogger.logEvent("Inserting a key after the freeze.", INFO);
+        testTreap.Insert(U(1));
+        if (frozen.Contains(U(1)))
+        {
+            testLogger.logEvent("The frozen tree changed with the treap.", FAIL);
+            status = FAIL;
+        }
+        testTreap.Clear();
+    }
+    catch (...)
+    {
+        testLogger.logEvent("Unexpected exception caught during the Freeze Test.", FAIL);
+        status = FAIL;
+    }
+
+    if (status == OK)
+    {
+        testLogger.printStatusMessage("Freeze Test Passed.", OK);
+    }
+    else
+    {
+        testLogger.printStatusMessage("Freeze Test Failed.", FAIL);
+        testLogger.setPassingStatus(FAIL);
+    }
+
+    testLogger.logEvent("", INFO);
+    testLogger.logEvent("******* End Freeze Test *******", INFO);
+    return status;
+}
+
+//****************************************************************************
+//  NAME: testForEach.
+//
+//  DESCRIPTION: Insert shuffled keys and walk the treap with each of the 
+//               visitor traversals.  The in order walk should see every 
+//               key in ascending order, the pre order walk should start 
+//               and the post order walk end at the root, and each walk 
+//               should stop as soon as the visitor returns false.
+// 
+//  PARAMETERS: N/A.
+//****************************************************************************
+template <class U>
+bool TestTreap<U>::testForEach()
+{
+    testLogger.logEvent("******* Begin ForEach Test *******", INFO);
+    int status = OK;
+
+    try
+    {
+        const int NUM_KEYS = 1000;
+        const int STOP_AFTER = 10;
+
+        testLogger.logEvent("Clearing the Treap.", INFO);
+        testTreap.Clear();
+
+        vector<int> keys;
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            keys.push_back(i);
+        }
+        mt19937 rng(7);
+        shuffle(keys.begin(), keys.end(), rng);
+
+        testLogger.logEvent("Inserting " + std::to_string(NUM_KEYS) + " shuffled keys into the treap.", INFO);
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            testTreap.Insert(U(keys[i]));
+        }
+
+        vector<U> inOrder;
+        vector<U> preOrder;
+        vector<U> postOrder;
+        bool completed = testTreap.ForEachInOrder([&](const U& key)
+        {
+            inOrder.push_back(key);
+            return true;
+        });
+        completed = testTreap.ForEachPreOrder([&](const U& key)
+        {
+            preOrder.push_back(key);
+            return true;
+        }) && completed;
+        completed = testTreap.ForEachPostOrder([&](const U& key)
+        {
+            postOrder.push_back(key);
+            return true;
+        }) && completed;
+
+        if (!completed || inOrder.size() != NUM_KEYS || preOrder.size() != NUM_KEYS ||
+            postOrder.size() != NUM_KEYS)
+        {
+            testLogger.logEvent("A traversal did not visit every key.", FAIL);
+            status = FAIL;
+        }
+        else
+        {
+            for (int i = 0; i < NUM_KEYS && status == OK; i++)
+            {
+                if (inOrder[i] != U(i))
+                {
+                    testLogger.logEvent("The in order walk visited " + std::to_string(inOrder[i]) +
+                                        " in place of " + std::to_string(i) + ".", FAIL);
+                    status = FAIL;
+                }
+            }
+
+            if (preOrder.front() != postOrder.back())
+            {
+                testLogger.logEvent("The pre and post order walks disagree on the root.", FAIL);
+                status = FAIL;
+            }
+        }
+
+        int visited = 0;
+        bool stopped = !testTreap.ForEachPostOrder([&](const U&)
+        {
+            visited++;
+            return visited < STOP_AFTER;
+        });
+
+        if (!stopped || visited != STOP_AFTER)
+        {
+            testLogger.logEvent("The walk did not stop when the visitor returned false.", FAIL);
+            status = FAIL;
+        }
+        testTreap.Clear();
+    }
+    catch (...)
+    {
+        testLogger.logEvent("Unexpected exception caught during the ForEach Test.", FAIL);
+        status = FAIL;
+    }
+
+    if (status == OK)
+    {
+        testLogger.printStatusMessage("ForEach Test Passed.", OK);
+    }
+    else
+    {
+        testLogger.printStatusMessage("ForEach Test Failed.", FAIL);
+        testLogger.setPassingStatus(FAIL);
+    }
+
+    testLogger.logEvent("", INFO);
+    testLogger.logEvent("******* End ForEach Test *******", INFO);
+    return status;
+}
+
 //****************************************************************************
 //  NAME: bulkInsert.
 //
@@ -534,6 +855,66 @@ void TestTreap<U>::benchmarkTreap(const vector<int>& data, const vector<int>& qu
     std::cout << "                Found = " << foundCount << "." << std::endl << std::endl;
 }
 
+//****************************************************************************
+//  NAME: benchmarkFrozenTreap.
+//
+//  DESCRIPTION: Freeze the treap filled by benchmarkTreap and record the 
+//               time it takes.  Then search the treap and the frozen tree
+//               for the same queries, the frozen tree both one at a time
+//               and as a batch, and display all results.
+// 
+//  PARAMETERS: queries: vector of values to be searched for.
+//****************************************************************************
+template <class U>
+void TestTreap<U>::benchmarkFrozenTreap(const vector<int>& queries)
+{
+    testLogger.logEvent("Freezing the treap.", INFO);
+
+    FrozenTree<U> frozen;
+    std::chrono::steady_clock::time_point start = steady_clock::now();
+    testTreap.Freeze(frozen);
+    std::chrono::steady_clock::time_point end = steady_clock::now();
+    long long freeze_time = duration_cast<microseconds>(end - start).count();
+
+    vector<U> keys(queries.begin(), queries.end());
+    int querySize = static_cast<int>(keys.size());
+
+    testLogger.logEvent("Searching the treap and the frozen tree to compare search times.", INFO);
+
+    int treapFound = 0;
+    start = steady_clock::now();
+    for (int q = 0; q < querySize; q++)
+    {
+        treapFound += testTreap.Search(keys[q]);
+    }
+    end = steady_clock::now();
+    long long treap_time = duration_cast<microseconds>(end - start).count();
+
+    int frozenFound = 0;
+    start = steady_clock::now();
+    for (int q = 0; q < querySize; q++)
+    {
+        frozenFound += frozen.Contains(keys[q]);
+    }
+    end = steady_clock::now();
+    long long frozen_time = duration_cast<microseconds>(end - start).count();
+
+    bool* found = new bool[querySize > 0 ? querySize : 1];
+    start = steady_clock::now();
+    int batchFound = frozen.ContainsBatch(querySize > 0 ? &keys[0] : nullptr, found, querySize);
+    end = steady_clock::now();
+    long long batch_time = duration_cast<microseconds>(end - start).count();
+    delete[] found;
+
+    std::cout << "          Frozen Treap: " << std::endl;
+    std::cout << "                Freeze time = " << freeze_time << " us." << std::endl;
+    std::cout << "                Treap search time = " << treap_time << " us." << std::endl;
+    std::cout << "                Frozen search time = " << frozen_time << " us." << std::endl;
+    std::cout << "                Frozen batch time = " << batch_time << " us." << std::endl;
+    std::cout << "                Found = " << treapFound << " / " << frozenFound 
+              << " / " << batchFound << "." << std::endl << std::endl;
+}
+
 //****************************************************************************
 //  NAME: benchmarkSet.
 //
@@ -665,6 +1046,7 @@ bool TestTreap<U>::runBenchmarkTest()
             " searches...", INFO);
 
         benchmarkTreap(data, queries);
+        benchmarkFrozenTreap(queries);
         benchmarkSet(data, queries);
         benchmarkUnorderedSet(data, queries);
 
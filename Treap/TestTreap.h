@@ -14,6 +14,7 @@
 #include <chrono>
 #include <set>
 #include <unordered_set>
+#include <algorithm>
 using namespace std::chrono;
 
 template <class U>
@@ -34,8 +35,12 @@ public:
 	bool testNotFoundSearch();
 	bool testAtRootSearch();
 	bool testSearch();
+	bool testDeepTreap();
+	bool testFreeze();
+	bool testForEach();
 
 	void benchmarkTreap(const vector<int>& data, const vector<int>& queries);
+	void benchmarkFrozenTreap(const vector<int>& queries);
 	void benchmarkSet(const vector<int>& data, const vector<int>& queries);
 	void benchmarkUnorderedSet(const vector<int>& data, const vector<int>& queries);
 	bool runBenchmarkTest();
@@ -9,8 +9,10 @@
 //****************************************************************************
 //	NAME: InsertHelper.
 //
-//  DESCRIPTION: Helper method to perform insertion.  If the heap order has 
-//               been violated, then a rotation will be performed.
+//  DESCRIPTION: Helper method to perform insertion.  The links passed on 
+//               the way down are recorded, and the new node is rotated up
+//               through them while the heap order is violated.  Once a 
+//               parent outranks the node, no rotation is needed above it.
 //
 //	PARAMETERS: key: the element to be inserted.
 //		        subtree: pointer to the root of subtree.
@@ -20,30 +22,42 @@ void Treap<T>::InsertHelper(T key, TreapNode<T>*& subtree)
 {
 	try
 	{
-		if (!subtree)
-		{
-			subtree = new TreapNode<T>(key);
-			return;
-		}
+		vector<TreapNode<T>**> path;
+		TreapNode<T>** link = &subtree;
 
-		if (key < subtree->data)
+		while (*link != nullptr)
 		{
-			InsertHelper(key, subtree->left);
+			path.push_back(link);
 
-			if (subtree->left != nullptr && subtree->left->priority >
-				subtree->priority)
+			if (key < (*link)->data)
+			{
+				link = &(*link)->left;
+			}
+			else
 			{
-				RotateRight(subtree);
+				link = &(*link)->right;
 			}
 		}
-		else
+
+		*link = new TreapNode<T>(key);
+
+		for (int i = (int)path.size() - 1; i >= 0; i--)
 		{
-			InsertHelper(key, subtree->right);
+			TreapNode<T>*& parent = *path[i];
 
-			if (subtree->right != nullptr && subtree->right->priority >
-				subtree->priority)
+			if (parent->left != nullptr && parent->left->priority >
+				parent->priority)
+			{
+				RotateRight(parent);
+			}
+			else if (parent->right != nullptr && parent->right->priority >
+				parent->priority)
 			{
-				RotateLeft(subtree);
+				RotateLeft(parent);
+			}
+			else
+			{
+				break;
 			}
 		}
 	}
@@ -121,19 +135,22 @@ bool Treap<T>::SearchHelper(T key, TreapNode<T>* subtree) const
 {
 	try
 	{
-		if (subtree == nullptr)
-		{
-			return false;
-		}
-		if (subtree->data == key)
+		while (subtree != nullptr)
 		{
-			return true;
-		}
-		if (key < subtree->data)
-		{
-			return SearchHelper(key, subtree->left);
+			if (subtree->data == key)
+			{
+				return true;
+			}
+			if (key < subtree->data)
+			{
+				subtree = subtree->left;
+			}
+			else
+			{
+				subtree = subtree->right;
+			}
 		}
-		return SearchHelper(key, subtree->right);
+		return false;
 	}
 	catch (...)
 	{
@@ -148,6 +165,9 @@ bool Treap<T>::SearchHelper(T key, TreapNode<T>* subtree) const
 // 
 //	DESCRIPTION: Helper method to delete a given key from the Treap.  If 
 //               the key is not in the Treap, then this function will return.
+//               Otherwise the node is rotated down towards its higher 
+//               priority child, following its link, until it has at most 
+//               one child and can be unlinked.
 //
 //	PARAMETERS: key: the element to be deleted.
 //		        subtree: pointer to the root of subtree.
@@ -157,58 +177,49 @@ void Treap<T>::DeleteHelper(T key, TreapNode<T>*& subtree)
 {
 	try
 	{
-		if (subtree == nullptr)
+		TreapNode<T>** link = &subtree;
+
+		while (*link != nullptr && !((*link)->data == key))
+		{
+			if (key < (*link)->data)
+			{
+				link = &(*link)->left;
+			}
+			else
+			{
+				link = &(*link)->right;
+			}
+		}
+
+		if (*link == nullptr)
 		{
 			return;
 		}
-		else
+
+		while ((*link)->left != nullptr && (*link)->right != nullptr)
 		{
-			if (key < subtree->data)
-			{
-				DeleteHelper(key, subtree->left);
-			}
-			else if (key > subtree->data)
+			if ((*link)->left->priority < (*link)->right->priority)
 			{
-				DeleteHelper(key, subtree->right);
+				RotateLeft(*link);
+				link = &(*link)->left;
 			}
 			else
 			{
-				if (subtree->left == nullptr && subtree->right == nullptr)
-				{
-					delete subtree;
-					subtree = nullptr;
-				}
-				else if (subtree->left && subtree->right)
-				{
-					if (subtree->left->priority < subtree->right->priority)
-					{
-						RotateLeft(subtree);
-						DeleteHelper(key, subtree->left);
-					}
-					else
-					{
-						RotateRight(subtree);
-						DeleteHelper(key, subtree->right);
-					}
-				}
-				else
-				{
-					TreapNode<T>* child;
-					if (subtree->left)
-					{
-						child = subtree->left;
-					}
-					else
-					{
-						child = subtree->right;
-					}
-
-					TreapNode<T>* curr = subtree;
-					subtree = child;
-					delete curr;
-				}
+				RotateRight(*link);
+				link = &(*link)->right;
 			}
 		}
+
+		TreapNode<T>* curr = *link;
+		if (curr->left)
+		{
+			*link = curr->left;
+		}
+		else
+		{
+			*link = curr->right;
+		}
+		delete curr;
 	}
 	catch (...)
 	{
@@ -220,10 +231,10 @@ void Treap<T>::DeleteHelper(T key, TreapNode<T>*& subtree)
 //****************************************************************************
 //  NAME: PruneHelper.
 // 
-//	DESCRIPTION: Helper method to traverse the tree and check each node to 
-//               see if it is a leaf.  If it is, the node will be deleted. 
-//               Otherwise, the traversal will continue until the entire tree
-//               has been pruned of leaves.
+//	DESCRIPTION: Helper method to remove every leaf from the tree, except 
+//               the root.  Each node on an explicit stack checks its 
+//               children, and a child that is a leaf is deleted, otherwise
+//               the child is pushed to be checked in turn.
 //
 //	PARAMETERS: subtree: pointer to the root of subtree.
 //****************************************************************************
@@ -232,19 +243,35 @@ void Treap<T>::PruneHelper(TreapNode<T>*& subtree)
 {
 	try
 	{
-		if (subtree == nullptr)
+		if (subtree == nullptr || isLeaf(subtree))
 		{
 			return;
 		}
-		else
+
+		vector<TreapNode<T>*> pending;
+		pending.push_back(subtree);
+
+		while (!pending.empty())
 		{
-			PruneHelper(subtree->left);
-			PruneHelper(subtree->right);
+			TreapNode<T>* node = pending.back();
+			pending.pop_back();
 
-			if (isLeaf(subtree) && subtree != root)
+			TreapNode<T>** links[2] = { &node->left, &node->right };
+			for (int i = 0; i < 2; i++)
 			{
-				delete subtree;
-				subtree = nullptr;
+				if (*links[i] == nullptr)
+				{
+					continue;
+				}
+				if (isLeaf(*links[i]))
+				{
+					delete *links[i];
+					*links[i] = nullptr;
+				}
+				else
+				{
+					pending.push_back(*links[i]);
+				}
 			}
 		}
 	}
@@ -270,10 +297,47 @@ void Treap<T>::Clear()
 	root = nullptr;
 }
 
+//****************************************************************************
+//  NAME: Freeze.
+// 
+//	DESCRIPTION: Treap method to export the keys into a read only frozen 
+//	             tree, replacing anything it held.  The keys are collected
+//	             by ForEachInOrder, so they are already sorted, and the
+//	             priorities are dropped.  Returns false if the keys could 
+//	             not be copied.
+//
+//	PARAMETERS: frozen: the frozen tree to fill.
+//****************************************************************************
+template <class T>
+bool Treap<T>::Freeze(FrozenTree<T>& frozen) const
+{
+	try
+	{
+		vector<T> keys;
+		ForEachInOrder([&](const T& key)
+		{
+			keys.push_back(key);
+			return true;
+		});
+
+		return frozen.Build(keys.empty() ? nullptr : &keys[0], 
+			                static_cast<int>(keys.size()));
+	}
+	catch (...)
+	{
+		std::cerr << "Unexpected exception caught while attempting to "
+			      << "freeze the treap." << std::endl;
+	}
+
+	frozen.Clear();
+	return false;
+}
+
 //****************************************************************************
 //  NAME: ClearHelper.
 // 
-//	DESCRIPTION: Helper method to deallocate all nodes of the tree.
+//	DESCRIPTION: Helper method to deallocate all nodes of the tree without 
+//               recursion.  See DestroyHelper.
 //
 //	PARAMETERS: subtree: pointer to the root of subtree.
 //****************************************************************************
@@ -282,13 +346,7 @@ void Treap<T>::ClearHelper(TreapNode<T>*& subtree)
 {
 	try
 	{
-		if (subtree != nullptr)
-		{
-			ClearHelper(subtree->left);
-			ClearHelper(subtree->right);
-			delete subtree;
-		}
-		subtree = nullptr;
+		DestroyHelper(subtree);
 	}
 	catch (...)
 	{
@@ -301,12 +359,18 @@ void Treap<T>::ClearHelper(TreapNode<T>*& subtree)
 //  NAME: TreePrint.
 // 
 //	DESCRIPTION: Treap method to print the contents of the tree in level 
-//               order.   
+//               order, each node with its priority.  The treap is walked 
+//               once and the text is written to the stream in large 
+//               blocks.  By default the whole treap is printed.  If 
+//               maxDepth or maxWidth is positive, levels past maxDepth are
+//               left out and lines are kept within maxWidth characters.
 //
-//	PARAMETERS: N/A.
+//	PARAMETERS: out: the stream to print to, such as cout or an ofstream.
+//	            maxDepth: the most levels to print, or 0 for no limit.
+//	            maxWidth: the most characters on a line, or 0 for no limit.
 //****************************************************************************
 template <class T>
-void Treap<T>::TreePrint() const
+void Treap<T>::TreePrint(ostream& out, int maxDepth, int maxWidth) const
 {
 	try
 	{
@@ -315,14 +379,12 @@ void Treap<T>::TreePrint() const
 			cerr << endl << "The treap is empty." << endl;
 			return;
 		}
-		else
+
+		TreePrinter printer(out, maxDepth, maxWidth);
+		printer.PrintLevels(root, [this](const TreapNode<T>* subtree)
 		{
-			for (int i = 0; i <= GetHeight(root); i++)
-			{
-				PrintLevel(i);
-				cout << endl << endl;
-			}
-		}
+			return NodeLabel(subtree);
+		});
 	}
 	catch (...)
 	{
@@ -332,109 +394,55 @@ void Treap<T>::TreePrint() const
 }
 
 //****************************************************************************
-//  NAME: PrintLevel.
-// 
-//	DESCRIPTION: Treap method to calculate the distance from the beginning 
-//               of a new line.    
-//
-//	PARAMETERS: level: current level that we are printing from.  
-//****************************************************************************
-template <class T>
-void Treap<T>::PrintLevel(int level) const
-{
-	TreapNode<T>* temp = root;
-
-	int value = pow(2, GetHeight(root) - level + 2);
-	cout << setw(value) << "";
-	DispLevel(temp, level, value);
-}
-
-//****************************************************************************
-//  NAME: DispLevel.
+//  NAME: PrintHierarchical.
 // 
-//	DESCRIPTION: Treap method to print the data and priority of the nodes and
-//	             calculates the distance between to points.     
+//	DESCRIPTION: Treap method to print the contents of the tree to resemble
+//               a file tree, with the same limits as TreePrint.
 //
-//	PARAMETERS: subtree: pointer the root of the subtree.
-//		        level: current level that we are printing from.
-//		        dist: the calculated distance between two points.
+//	PARAMETERS: out: the stream to print to, such as cout or an ofstream.
+//	            maxDepth: the most levels to print, or 0 for no limit.
+//	            maxWidth: the most characters on a line, or 0 for no limit.
 //****************************************************************************
 template <class T>
-void Treap<T>::DispLevel(TreapNode<T>* subtree, int level, int dist) const
+void Treap<T>::PrintHierarchical(ostream& out, int maxDepth, int maxWidth) const
 {
-	int disp = 2 * dist;
-	if (level == 0)
+	try
 	{
-		if (subtree == nullptr)
-		{
-			cout << " x ";
-			cout << setw(disp - 3) << "";
-			return;
-		}
-		else
+		TreePrinter printer(out, maxDepth, maxWidth);
+		printer.PrintHierarchical(root, [this](const TreapNode<T>* subtree)
 		{
-			int result = 0;
-			if (subtree->priority <= 1)
-			{
-				result = 1;
-			}
-			else
-			{
-				result = (log10(subtree->priority) + 1);
-			}
-
-			cout << " " << subtree->data << " (" << subtree->priority << ") ";
-			cout << setw(disp - result - 5) << "";
-		}
+			return NodeLabel(subtree);
+		});
 	}
-	else
+	catch (...)
 	{
-		if (subtree == nullptr && level >= 1)
-		{
-			DispLevel(nullptr, level - 1, dist);
-			DispLevel(nullptr, level - 1, dist);
-		}
-		else
-		{
-			DispLevel(subtree->left, level - 1, dist);
-			DispLevel(subtree->right, level - 1, dist);
-		}
+		std::cerr << "Unexpected exception caught while attempting to "
+			      << "print the contents of the treap." << std::endl;
 	}
 }
 
 //****************************************************************************
-//  NAME: GetHeight.
+//  NAME: NodeLabel.
 // 
-//	DESCRIPTION: Utility function to return the height of the Treap.
+//	DESCRIPTION: Helper method to return the text shown for a node by the 
+//               printers, which is its key followed by its priority.
 //
-//	PARAMETERS: subtree: pointer to the root of subtree.
+//	PARAMETERS: subtree: node to be displayed.
 //****************************************************************************
 template <class T>
-int Treap<T>::GetHeight(TreapNode<T>* subtree) const
+string Treap<T>::NodeLabel(const TreapNode<T>* subtree) const
 {
-	if (subtree == nullptr)
-	{
-		return 0;
-	}
-	else
-	{
-		int leftHeight = GetHeight(subtree->left);
-		int rightHeight = GetHeight(subtree->right);
-		if (leftHeight >= rightHeight)
-		{
-			return leftHeight + 1;
-		}
-		else
-		{
-			return rightHeight + 1;
-		}
-	}
+	ostringstream text;
+	text << subtree->data << " (" << subtree->priority << ")";
+	return text.str();
 }
 
 //****************************************************************************
 //  NAME: InOrderHelper.
 // 
 //	DESCRIPTION: Helper method to print the contents of the Treap in order.
+//	             The left spine of each subtree is pushed onto an explicit 
+//	             stack in place of recursion.
 //
 //	PARAMETERS: subtree: pointer to the root of subtree.
 //****************************************************************************
@@ -443,11 +451,21 @@ void Treap<T>::InOrderHelper(TreapNode<T>* subtree) const
 {
 	try
 	{
-		if (subtree)
+		vector<TreapNode<T>*> pending;
+
+		while (subtree != nullptr || !pending.empty())
 		{
-			InOrderHelper(subtree->left);
+			while (subtree != nullptr)
+			{
+				pending.push_back(subtree);
+				subtree = subtree->left;
+			}
+
+			subtree = pending.back();
+			pending.pop_back();
+
 			cout << subtree->data << " (" << subtree->priority << ")" << endl;
-			InOrderHelper(subtree->right);
+			subtree = subtree->right;
 		}
 	}
 	catch (...)
@@ -461,7 +479,7 @@ void Treap<T>::InOrderHelper(TreapNode<T>* subtree) const
 //  NAME: PreOrderHelper.
 // 
 //	DESCRIPTION: Helper method to print the contents of the Treap in pre order
-//	             processing.
+//	             processing, using an explicit stack in place of recursion.
 //
 //	PARAMETERS: subtree: pointer to the root of subtree.
 //****************************************************************************
@@ -470,11 +488,29 @@ void Treap<T>::PreOrderHelper(TreapNode<T>* subtree) const
 {
 	try
 	{
-		if (subtree)
+		if (subtree == nullptr)
+		{
+			return;
+		}
+
+		vector<TreapNode<T>*> pending;
+		pending.push_back(subtree);
+
+		while (!pending.empty())
 		{
+			subtree = pending.back();
+			pending.pop_back();
+
 			cout << subtree->data << " (" << subtree->priority << ")" << endl;
-			PreOrderHelper(subtree->left);
-			PreOrderHelper(subtree->right);
+
+			if (subtree->right)
+			{
+				pending.push_back(subtree->right);
+			}
+			if (subtree->left)
+			{
+				pending.push_back(subtree->left);
+			}
 		}
 	}
 	catch (...)
@@ -488,7 +524,9 @@ void Treap<T>::PreOrderHelper(TreapNode<T>* subtree) const
 //  NAME: PostOrderHelper.
 // 
 //	DESCRIPTION: Helper method to print the contents of the Treap in post order
-//	             processing.
+//	             processing, using an explicit stack in place of recursion.  
+//	             A node is printed once the last node printed is its right 
+//	             child, or it has no right child.
 //
 //	PARAMETERS: subtree: pointer to the root of subtree.
 //****************************************************************************
@@ -497,11 +535,28 @@ void Treap<T>::PostOrderHelper(TreapNode<T>* subtree) const
 {
 	try
 	{
-		if (subtree)
+		vector<TreapNode<T>*> pending;
+		TreapNode<T>* lastPrinted = nullptr;
+
+		while (subtree != nullptr || !pending.empty())
 		{
-			PostOrderHelper(subtree->left);
-			PostOrderHelper(subtree->right);
-			cout << subtree->data << " (" << subtree->priority << ")" << endl;
+			while (subtree != nullptr)
+			{
+				pending.push_back(subtree);
+				subtree = subtree->left;
+			}
+
+			TreapNode<T>* top = pending.back();
+
+			if (top->right != nullptr && top->right != lastPrinted)
+			{
+				subtree = top->right;
+				continue;
+			}
+
+			cout << top->data << " (" << top->priority << ")" << endl;
+			lastPrinted = top;
+			pending.pop_back();
 		}
 	}
 	catch (...)
@@ -526,20 +581,38 @@ Treap<T>::Treap(const Treap& myTreap)
 }
 
 //****************************************************************************
-//		Helper method for Copy Constructor.
+//		Helper method for Copy Constructor.  Pairs of source nodes and the 
+//	links they are copied into are kept on an explicit stack, and each copy
+//	keeps the priority of its source node so the heap order holds.
 //****************************************************************************
 template<class T>
 void Treap<T>::CopyHelper(TreapNode<T>*& aRoot, TreapNode<T>* myRoot)
 {
-	if (!myRoot)
+	aRoot = nullptr;
+
+	vector<pair<TreapNode<T>*, TreapNode<T>**> > pending;
+	if (myRoot)
 	{
-		aRoot = nullptr;
+		pending.push_back(make_pair(myRoot, &aRoot));
 	}
-	else
+
+	while (!pending.empty())
 	{
-		aRoot = new TreapNode<T>(myRoot->data);
-		CopyHelper(aRoot->left, myRoot->left);
-		CopyHelper(aRoot->right, myRoot->right);
+		TreapNode<T>*  source = pending.back().first;
+		TreapNode<T>** link   = pending.back().second;
+		pending.pop_back();
+
+		*link = new TreapNode<T>(source->data);
+		(*link)->priority = source->priority;
+
+		if (source->right)
+		{
+			pending.push_back(make_pair(source->right, &(*link)->right));
+		}
+		if (source->left)
+		{
+			pending.push_back(make_pair(source->left, &(*link)->left));
+		}
 	}
 }
 
@@ -554,18 +627,30 @@ Treap<T>::~Treap()
 }
 
 //****************************************************************************
-//		Helper method to for Destructor.
+//		Helper method to for Destructor.  The tree is deallocated without 
+//	recursion or extra memory: while the current node has a left child it
+//	is rotated right, and a node with no left child is deleted and its 
+//	right child taken in its place.
 //****************************************************************************
 template <class T>
 void Treap<T>::DestroyHelper(TreapNode<T>*& Tree)
 {
-	if (Tree != nullptr)
+	while (Tree != nullptr)
 	{
-		DestroyHelper(Tree->left);
-		DestroyHelper(Tree->right);
-		delete Tree;
+		if (Tree->left != nullptr)
+		{
+			TreapNode<T>* temp = Tree->left;
+			Tree->left = temp->right;
+			temp->right = Tree;
+			Tree = temp;
+		}
+		else
+		{
+			TreapNode<T>* temp = Tree->right;
+			delete Tree;
+			Tree = temp;
+		}
 	}
-	Tree = nullptr;
 }
 
 //****************************************************************************
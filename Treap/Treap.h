@@ -10,9 +10,14 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <sstream>
 #include <ctime>
 #include <cmath>
 #include <cstdlib>
+#include <vector>
+#include <utility>
+#include "FrozenTree.h"
+#include "TreePrinter.h"
 using namespace std;
 
 template <class T>
@@ -30,6 +35,7 @@ class TreapNode
 		priority(rand() % 100) {}
 
 	friend class Treap<T>;
+	friend class TreePrinter;
 };
 
 template <class T>
@@ -44,11 +50,24 @@ public:
 	void Clear();
 
 	void Prune() { return PruneHelper(root); };
-
-	void TreePrint() const;
+	bool Freeze(FrozenTree<T>& frozen) const;
+
+	void TreePrint() const { TreePrint(cout); }
+	void TreePrint(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+		int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
+	void PrintHierarchical() const { PrintHierarchical(cout); }
+	void PrintHierarchical(ostream& out, int maxDepth = TREE_PRINTER_MAX_DEPTH,
+		int maxWidth = TREE_PRINTER_MAX_WIDTH) const;
 	void InOrder() const { return InOrderHelper(root); }
 	void PreOrder() const { return PreOrderHelper(root); }
-	void PostOrder() const { return InOrderHelper(root); }
+	void PostOrder() const { return PostOrderHelper(root); }
+
+	template <class Visitor>
+	bool ForEachInOrder(Visitor visit) const;
+	template <class Visitor>
+	bool ForEachPreOrder(Visitor visit) const;
+	template <class Visitor>
+	bool ForEachPostOrder(Visitor visit) const;
 
 	Treap(const Treap& myTreap);
 	~Treap();
@@ -72,9 +91,7 @@ private:
 	}
 
 	// Print Helper Functions.
-	int GetHeight(TreapNode<T>* subtree) const;
-	void PrintLevel(int height) const;
-	void DispLevel(TreapNode<T>* subtree, int level, int dist) const;
+	string NodeLabel(const TreapNode<T>* subtree) const;
 
 	void InOrderHelper(TreapNode<T>* subtree) const;
 	void PreOrderHelper(TreapNode<T>* subtree) const;
@@ -84,4 +101,129 @@ private:
 	void DestroyHelper(TreapNode<T>*& Tree);
 };
 
-#endif
\ No newline at end of file
+//****************************************************************************
+//  NAME: ForEachInOrder.
+// 
+//	DESCRIPTION: Treap method to call visit on every key in order, without
+//               printing anything.  It is defined in the header so the
+//               callback can be any function or function object and can
+//               be inlined into the walk.  The walk stops as soon as visit
+//               returns false, and the method returns false if it was
+//               stopped early.
+//
+//	PARAMETERS: visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool Treap<T>::ForEachInOrder(Visitor visit) const
+{
+	vector<const TreapNode<T>*> pending;
+	const TreapNode<T>* node = root;
+
+	while (node != nullptr || !pending.empty())
+	{
+		while (node != nullptr)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+
+		node = pending.back();
+		pending.pop_back();
+
+		if (!visit(node->data))
+		{
+			return false;
+		}
+		node = node->right;
+	}
+	return true;
+}
+
+//****************************************************************************
+//  NAME: ForEachPreOrder.
+// 
+//	DESCRIPTION: Treap method to call visit on every key in pre order,
+//               each node before its children, like ForEachInOrder.
+//
+//	PARAMETERS: visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool Treap<T>::ForEachPreOrder(Visitor visit) const
+{
+	vector<const TreapNode<T>*> pending;
+
+	if (root != nullptr)
+	{
+		pending.push_back(root);
+	}
+
+	while (!pending.empty())
+	{
+		const TreapNode<T>* node = pending.back();
+		pending.pop_back();
+
+		if (!visit(node->data))
+		{
+			return false;
+		}
+
+		if (node->right != nullptr)
+		{
+			pending.push_back(node->right);
+		}
+		if (node->left != nullptr)
+		{
+			pending.push_back(node->left);
+		}
+	}
+	return true;
+}
+
+//****************************************************************************
+//  NAME: ForEachPostOrder.
+// 
+//	DESCRIPTION: Treap method to call visit on every key in post order,
+//               each node after its children, like ForEachInOrder.  A
+//               node stays on the stack until its right subtree is done,
+//               which is known when the last node visited is its right
+//               child.
+//
+//	PARAMETERS: visit: called with each key, returns false to stop the walk.
+//****************************************************************************
+template <class T>
+template <class Visitor>
+bool Treap<T>::ForEachPostOrder(Visitor visit) const
+{
+	vector<const TreapNode<T>*> pending;
+	const TreapNode<T>* node = root;
+	const TreapNode<T>* last = nullptr;
+
+	while (node != nullptr || !pending.empty())
+	{
+		while (node != nullptr)
+		{
+			pending.push_back(node);
+			node = node->left;
+		}
+
+		const TreapNode<T>* top = pending.back();
+		if (top->right != nullptr && top->right != last)
+		{
+			node = top->right;
+		}
+		else
+		{
+			if (!visit(top->data))
+			{
+				return false;
+			}
+			last = top;
+			pending.pop_back();
+		}
+	}
+	return true;
+}
+
+#endif
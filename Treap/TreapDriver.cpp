@@ -149,16 +149,17 @@ void printMainMenu()
 //****************************************************************************
 void printMenu()
 {
-	cout << " ________________________________ " << endl;
-	cout << "| +Item | Insert Item            |" << endl;
-	cout << "| -Item | Delete Item            |" << endl;
-	cout << "| ?Item | Search Item            |" << endl;
-	cout << "|   R   | Prune Treap            |" << endl;
-	cout << "|   I   | Print Items In Order   |" << endl;
-	cout << "|   P   | Print Items Pre Order  |" << endl;
-	cout << "|   T   | Print Items Post Order |" << endl;
-	cout << "|   D   | Destory the Treap      |" << endl;
-	cout << "|_______|________________________|" << endl << endl;
+	cout << " ________________________________________ " << endl;
+	cout << "| +Item | Insert Item                    |" << endl;
+	cout << "| -Item | Delete Item                    |" << endl;
+	cout << "| ?Item | Search Item                    |" << endl;
+	cout << "|   R   | Prune Treap                    |" << endl;
+	cout << "|   I   | Print Items In Order           |" << endl;
+	cout << "|   P   | Print Items Pre Order          |" << endl;
+	cout << "|   T   | Print Items Post Order         |" << endl;
+	cout << "|   H   | Print Items Hierarchical Order |" << endl;
+	cout << "|   D   | Destory the Treap              |" << endl;
+	cout << "|_______|________________________________|" << endl << endl;
 	cout << "Please choose an operation to perform on the treap." << endl;
 	cout << "Enter Q to quit." << endl;
 }
@@ -279,6 +280,23 @@ void choose(Treap<T>& myTreap)
 				system("pause");
 				break;
 			}
+			case 'h': case 'H':
+			{
+				if (hasInserted)
+				{
+					cout << endl;
+					cout << "The contents of the treap in hierarchical order are: ";
+					cout << endl;
+					myTreap.PrintHierarchical();
+					cout << endl << endl;
+				}
+				else
+				{
+					cerr << "The treap is empty." << endl;
+				}
+				system("pause");
+				break;
+			}
 			case 'd': case 'D':
 			{
 				myTreap.Clear();
@@ -0,0 +1,290 @@
+//***************************************************************************
+//	Header File for Tree Printer
+//	Programmed by: Houston Brown
+//	Last Compiled Date: 10/19/2026
+//***************************************************************************
+
+#ifndef _TREEPRINTER_H
+#define _TREEPRINTER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+using namespace std;
+
+// Number of characters collected before they are written to the stream.
+#define TREE_PRINTER_BUFFER_SIZE 65536
+
+// Limits used by the trees' print methods when none are given.  A limit 
+// of zero or less means no limit, so by default the whole tree is shown; 
+// pass limits to render part of a huge tree.
+#define TREE_PRINTER_MAX_DEPTH 0
+#define TREE_PRINTER_MAX_WIDTH 0
+
+// The level view never lays out more levels than this, even with no limits,
+// since every level doubles the width of the bottom line; a view this deep
+// is already millions of characters wide.
+#define TREE_PRINTER_MAX_LEVELS 20
+
+//***************************************************************************
+//	Renders a binary tree as text in one pass over the nodes.  Output is
+//	collected in a buffer and written to the stream in large blocks, so
+//	any ostream, including an ofstream, can be the sink.  The level view
+//	shows the tree top down, one line per level, and the hierarchical view
+//	shows it like a file tree, one line per node.  Levels past the depth
+//	limit are left out and lines are kept within the width limit, so huge
+//	trees can be rendered in part.
+//
+//	The node type must have left and right pointers and befriend this
+//	class.  The label callback returns the text to show for a node.
+//***************************************************************************
+class TreePrinter
+{
+public:
+	TreePrinter(ostream& sink, int depthLimit = TREE_PRINTER_MAX_DEPTH,
+				int widthLimit = TREE_PRINTER_MAX_WIDTH);
+
+	template <class Node, class Label>
+	void PrintLevels(const Node* root, Label label);
+
+	template <class Node, class Label>
+	void PrintHierarchical(const Node* root, Label label);
+
+	void Flush();
+
+	~TreePrinter();
+
+private:
+	ostream& out;
+	string   buffer;
+	int      maxDepth;
+	int      maxWidth;
+
+	void WriteLine(const string& line);
+};
+
+//***************************************************************************
+//		Method to print the tree one level per line with a single breadth
+//	first walk.  Each node is stored with its position in a complete tree,
+//	so the spacing can be worked out once the number of levels shown and
+//	the widest label are known, without walking the tree again.  Levels
+//	are left out at the bottom until the rest fit in the width limit, and
+//	a line of "..." is printed if any were.
+//
+//	Parameters:
+//		root: pointer to the root of the tree.
+//		label: returns the text to show for a node.
+//***************************************************************************
+template <class Node, class Label>
+void TreePrinter::PrintLevels(const Node* root, Label label)
+{
+	typedef pair<const Node*, long long> Slot;
+
+	vector<vector<Slot> >   levels;
+	vector<vector<string> > labels;
+	vector<size_t>          widest;
+	bool cut = false;
+
+	// Every label takes at least two characters on the bottom level, which
+	// bounds how many levels can fit in the width.
+	int depthLimit = 1;
+	while (depthLimit < TREE_PRINTER_MAX_LEVELS && 
+		   (maxWidth <= 0 || (2LL << depthLimit) <= maxWidth))
+	{
+		depthLimit++;
+	}
+	if (maxDepth > 0 && maxDepth < depthLimit)
+	{
+		depthLimit = maxDepth;
+	}
+
+	if (root != NULL)
+	{
+		levels.push_back(vector<Slot>(1, Slot(root, 0)));
+	}
+
+	while (!levels.empty() && !levels.back().empty())
+	{
+		vector<Slot>& level = levels.back();
+		vector<Slot>  next;
+
+		labels.push_back(vector<string>());
+		labels.back().reserve(level.size());
+		widest.push_back(0);
+
+		for (size_t i = 0; i < level.size(); i++)
+		{
+			const Node* node = level[i].first;
+			labels.back().push_back(label(node));
+			widest.back() = max(widest.back(), labels.back().back().size());
+
+			if (node->left != NULL)
+			{
+				next.push_back(Slot(node->left, 2 * level[i].second));
+			}
+			if (node->right != NULL)
+			{
+				next.push_back(Slot(node->right, 2 * level[i].second + 1));
+			}
+		}
+
+		if ((int)levels.size() == depthLimit)
+		{
+			cut = !next.empty();
+			break;
+		}
+		levels.push_back(next);
+	}
+
+	if (!levels.empty() && levels.back().empty())
+	{
+		levels.pop_back();
+	}
+	if (levels.empty())
+	{
+		return;
+	}
+
+	// Drop bottom levels until the widest label, plus a space between 
+	// neighbors, fits on the bottom level.
+	int       numLevels = (int)levels.size();
+	long long cellWidth = 0;
+	for (;;)
+	{
+		cellWidth = (long long)*max_element(widest.begin(), 
+											widest.begin() + numLevels) + 1;
+		if (numLevels == 1 || maxWidth <= 0 || 
+			(cellWidth << (numLevels - 1)) <= maxWidth)
+		{
+			break;
+		}
+		numLevels--;
+		cut = true;
+	}
+
+	long long lineWidth = cellWidth << (numLevels - 1);
+	if (maxWidth > 0 && lineWidth > maxWidth)
+	{
+		lineWidth = maxWidth;
+	}
+
+	string line;
+	for (int depth = 0; depth < numLevels; depth++)
+	{
+		long long slotWidth = cellWidth << (numLevels - 1 - depth);
+		line.assign((size_t)lineWidth, ' ');
+
+		for (size_t i = 0; i < levels[depth].size(); i++)
+		{
+			const string& text  = labels[depth][i];
+			long long     start = levels[depth][i].second * slotWidth +
+								  (slotWidth - (long long)text.size()) / 2;
+			if (start >= lineWidth)
+			{
+				break;
+			}
+
+			size_t length = text.size();
+			if (start + (long long)length > lineWidth)
+			{
+				length = (size_t)(lineWidth - start);
+			}
+			line.replace((size_t)start, length, text, 0, length);
+		}
+
+		size_t end = line.find_last_not_of(' ');
+		line.erase(end == string::npos ? 0 : end + 1);
+		WriteLine(line);
+		WriteLine("");
+	}
+
+	if (cut)
+	{
+		WriteLine("...");
+	}
+	Flush();
+}
+
+//***************************************************************************
+//		Method to print the tree like a file tree, one node per line, left
+//	child first.  The walk uses an explicit stack, and the indentation is
+//	kept in one string in which each node sets the four characters for its
+//	own depth, since the nodes printed before it at shallower depths are
+//	its ancestors.  A "..." line marks children past the depth limit.
+//
+//	Parameters:
+//		root: pointer to the root of the tree.
+//		label: returns the text to show for a node.
+//***************************************************************************
+template <class Node, class Label>
+void TreePrinter::PrintHierarchical(const Node* root, Label label)
+{
+	struct Entry
+	{
+		const Node* node;
+		int         depth;
+		bool        isLeft;
+	};
+
+	vector<Entry> pending;
+	string indent;
+	string line;
+
+	if (root != NULL)
+	{
+		Entry first = { root, 0, false };
+		pending.push_back(first);
+	}
+
+	while (!pending.empty())
+	{
+		Entry entry = pending.back();
+		pending.pop_back();
+
+		indent.resize(4 * (entry.depth + 1), ' ');
+		indent.replace(4 * entry.depth, 4, entry.isLeft ? "|   " : "    ");
+
+		line.assign(indent, 0, 4 * entry.depth);
+		line.append(entry.isLeft ? "|-- " : "L-- ");
+		line.append(label(entry.node));
+		if (maxWidth > 0 && line.size() > (size_t)maxWidth)
+		{
+			line.resize(maxWidth);
+		}
+		WriteLine(line);
+
+		const Node* node = entry.node;
+		if (node->left == NULL && node->right == NULL)
+		{
+			continue;
+		}
+
+		if (maxDepth > 0 && entry.depth + 1 >= maxDepth)
+		{
+			line.assign(indent);
+			line.append("...");
+			if (maxWidth > 0 && line.size() > (size_t)maxWidth)
+			{
+				line.resize(maxWidth);
+			}
+			WriteLine(line);
+			continue;
+		}
+
+		if (node->right != NULL)
+		{
+			Entry right = { node->right, entry.depth + 1, false };
+			pending.push_back(right);
+		}
+		if (node->left != NULL)
+		{
+			Entry left = { node->left, entry.depth + 1, true };
+			pending.push_back(left);
+		}
+	}
+	Flush();
+}
+
+#endif